@@ -0,0 +1,83 @@
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+/**
+ * Numarare alocari pe heap: inlocuieste operator new/delete globali.
+ * Se include intr-un SINGUR .cpp per executabil (defineste functii globale).
+ */
+namespace bench {
+
+inline std::atomic<size_t> allocationCount(0);
+
+inline size_t allocations() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace bench
+
+// GCC vede (dupa inlining) perechea operator new -> free si o raporteaza ca
+// nepotrivita; aici free este exact dealocatorul corect
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    bench::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Varianta aliniata (AlignedAllocator, Arena, SlabPool)
+void* operator new(std::size_t size, std::align_val_t align) {
+    bench::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    size_t alignment = static_cast<size_t>(align) < sizeof(void*) ? sizeof(void*) : static_cast<size_t>(align);
+#ifdef _WIN32
+    if (void* p = _aligned_malloc(size == 0 ? 1 : size, alignment)) {
+        return p;
+    }
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, alignment, size == 0 ? 1 : size) == 0) {
+        return p;
+    }
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    operator delete(p, std::align_val_t{});
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // ALLOC_COUNTER_HPP
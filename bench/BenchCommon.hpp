@@ -0,0 +1,65 @@
+#ifndef BENCH_COMMON_HPP
+#define BENCH_COMMON_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <vector>
+
+/**
+ * Utilitare comune pentru benchmark-uri:
+ * - Stopwatch: masurare timp cu steady_clock
+ * - CoutSilencer: redirectioneaza std::cout catre "nicaieri" (RAII)
+ * - percentile: p50/p99 dintr-un set de masuratori
+ */
+namespace bench {
+
+class Stopwatch {
+private:
+    std::chrono::steady_clock::time_point start;
+
+public:
+    Stopwatch() : start(std::chrono::steady_clock::now()) {}
+    
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+// streambuf care arunca tot ce primeste
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// RAII: cat timp obiectul traieste, std::cout nu mai scrie nimic
+class CoutSilencer {
+private:
+    NullBuffer nullBuffer;
+    std::streambuf* previous;
+
+public:
+    CoutSilencer() : previous(std::cout.rdbuf(&nullBuffer)) {}
+    ~CoutSilencer() { std::cout.rdbuf(previous); }
+    
+    CoutSilencer(const CoutSilencer&) = delete;
+    CoutSilencer& operator=(const CoutSilencer&) = delete;
+};
+
+// Percentila p (0..100) - sorteaza vectorul primit
+template <typename T>
+T percentile(std::vector<T>& samples, double p) {
+    if (samples.empty()) {
+        return T{};
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(p / 100.0 * static_cast<double>(samples.size() - 1) + 0.5);
+    return samples[std::min(index, samples.size() - 1)];
+}
+
+} // namespace bench
+
+#endif // BENCH_COMMON_HPP
@@ -0,0 +1,112 @@
+#include "ResourceManager.hpp"
+#include "Task.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: cereri concurente cu corutine vs thread-uri blocate
+ *
+ * Fiecare "request handler" face 2 interogari una dupa alta (round-trip
+ * implicit 10 ms) pe o conexiune proprie la serverul simulat.
+ *
+ * - corutine: N handler-e pornite deodata pe un AsyncExecutor cu 4 thread-uri;
+ *   toate interogarile sunt in zbor simultan
+ * - blocant:  4 thread-uri, fiecare ruleaza handler-e cu executeQuery
+ *   (rulat pe mai putine cereri si raportat ca debit)
+ *
+ * Utilizare: bench_async_query [handlere] [round_trip_ms]
+ */
+
+#if EFFECTIVECPP_HAS_COROUTINES
+
+namespace {
+
+Task<size_t> handleRequest(DatabaseConnection& db, const PreparedStatement& statement, int id) {
+    std::vector<std::string> params{std::to_string(id)};
+    std::string user = co_await db.query(statement, params);
+    std::string orders = co_await db.query("SELECT * FROM orders WHERE user = " + std::to_string(id));
+    co_return user.size() + orders.size();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int handlers = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int rttMs = argc > 2 ? std::atoi(argv[2]) : 10;
+    const size_t threads = 4;
+    logging::setLevel(logging::Level::Off);
+
+    SimulatedDatabaseOptions options;
+    options.connectLatency = std::chrono::microseconds(0);
+    options.roundTrip = std::chrono::milliseconds(rttMs);
+    SimulatedDatabaseServer server(options);
+    PreparedStatement selectUser = DatabaseConnection::prepare("SELECT * FROM users WHERE id = ?");
+
+    std::vector<std::unique_ptr<DatabaseConnection>> connections;
+    connections.reserve(handlers);
+    for (int i = 0; i < handlers; ++i) {
+        connections.push_back(std::make_unique<DatabaseConnection>("localhost:5432/bench", &server));
+    }
+
+    std::cout << handlers << " handler-e x 2 interogari, round-trip " << rttMs << " ms, " << threads
+              << " thread-uri\n\n";
+
+    // --- Corutine ---
+    {
+        AsyncExecutor executor(threads);
+        bench::Stopwatch timer;
+        std::vector<std::future<size_t>> results;
+        results.reserve(handlers);
+        for (int i = 0; i < handlers; ++i) {
+            results.push_back(spawn(executor, handleRequest(*connections[i], selectUser, i)));
+        }
+        size_t bytes = 0;
+        for (auto& r : results) {
+            bytes += r.get();
+        }
+        double seconds = timer.seconds();
+        std::cout << std::left << std::setw(12) << "corutine" << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(10) << seconds << " s" << std::setprecision(0) << std::setw(12)
+                  << handlers / seconds << " handler-e/s   (" << bytes << " bytes)" << std::endl;
+    }
+
+    // --- Blocant: 4 thread-uri, cate un handler o data ---
+    {
+        int blockingHandlers = std::min(handlers, 200);
+        std::atomic<int> next{0};
+        bench::Stopwatch timer;
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                for (int i = next++; i < blockingHandlers; i = next++) {
+                    DatabaseConnection& db = *connections[i];
+                    db.executeQuery(selectUser.render({std::to_string(i)}));
+                    db.executeQuery("SELECT * FROM orders WHERE user = " + std::to_string(i));
+                }
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+        double seconds = timer.seconds();
+        std::cout << std::left << std::setw(12) << "blocant" << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(10) << seconds << " s" << std::setprecision(0) << std::setw(12)
+                  << blockingHandlers / seconds << " handler-e/s   (" << blockingHandlers
+                  << " handler-e; " << handlers << " ar dura ~" << std::setprecision(1)
+                  << seconds * handlers / blockingHandlers << " s)" << std::endl;
+    }
+
+    std::cout << "\nInterogari executate pe server: " << server.queryCount() << std::endl;
+    return 0;
+}
+
+#else
+
+int main() {
+    std::cout << "Compilatorul nu suporta corutine C++20" << std::endl;
+    return 0;
+}
+
+#endif
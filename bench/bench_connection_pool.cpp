@@ -0,0 +1,95 @@
+#include "ResourceManager.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: latenta unei cereri cu conexiune noua vs conexiune din pool
+ *
+ * Serverul simulat costa 2 ms pentru handshake si 100 us per round-trip.
+ * Fiecare thread trimite cereri una dupa alta; masuram latenta fiecarei
+ * cereri (obtinere conexiune + o interogare) si raportam p50/p99/p99.9.
+ *
+ * - fresh: DatabaseConnection construit (si distrus) pentru fiecare cerere
+ * - pool:  lease din DatabaseConnectionPool (maxSize = numarul de thread-uri)
+ *
+ * Utilizare: bench_connection_pool [cereri_per_thread]
+ */
+
+namespace {
+
+struct Result {
+    double throughput;
+    double p50, p99, p999;
+};
+
+template <typename Request>
+Result run(int threads, int requests, Request request) {
+    std::vector<std::vector<double>> latencies(threads);
+    bench::Stopwatch total;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            latencies[t].reserve(requests);
+            for (int i = 0; i < requests; ++i) {
+                bench::Stopwatch timer;
+                request();
+                latencies[t].push_back(timer.seconds() * 1e6);
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    double seconds = total.seconds();
+
+    std::vector<double> all;
+    for (auto& l : latencies) {
+        all.insert(all.end(), l.begin(), l.end());
+    }
+    return {static_cast<double>(all.size()) / seconds, bench::percentile(all, 50),
+            bench::percentile(all, 99), bench::percentile(all, 99.9)};
+}
+
+void row(const char* name, int threads, const Result& r) {
+    std::cout << std::left << std::setw(8) << name << std::right << std::setw(8) << threads << std::fixed
+              << std::setprecision(0) << std::setw(12) << r.throughput << std::setw(10) << r.p50
+              << std::setw(10) << r.p99 << std::setw(10) << r.p999 << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int requests = argc > 1 ? std::atoi(argv[1]) : 500;
+    logging::setLevel(logging::Level::Off);
+
+    SimulatedDatabaseServer server;
+    const std::string connStr = "localhost:5432/bench";
+
+    std::cout << "Latenta per cerere (us), " << requests << " cereri per thread\n\n";
+    std::cout << std::left << std::setw(8) << "mod" << std::right << std::setw(8) << "threads"
+              << std::setw(12) << "cereri/s" << std::setw(10) << "p50" << std::setw(10) << "p99"
+              << std::setw(10) << "p99.9" << "\n";
+
+    for (int threads : {1, 4, 16}) {
+        Result fresh = run(threads, requests, [&]() {
+            DatabaseConnection db(connStr, &server);
+            db.executeQuery("SELECT 1");
+        });
+        row("fresh", threads, fresh);
+
+        ConnectionPoolOptions options;
+        options.minSize = static_cast<size_t>(threads);
+        options.maxSize = static_cast<size_t>(threads);
+        auto pool = makeDatabaseConnectionPool(server, connStr, options);
+        Result pooled = run(threads, requests, [&]() {
+            DatabaseConnectionPool::Lease db = pool->acquire();
+            db->executeQuery("SELECT 1");
+        });
+        row("pool", threads, pooled);
+    }
+
+    std::cout << "\nHandshake-uri pe server: " << server.connectCount() << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "StripedCounter.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+/**
+ * Benchmark: throughput contoare partajate, 1..N thread-uri
+ *
+ * - unsafe:  load + store relaxed pe un atomic comun (modeleaza incrementarea
+ *            nesincronizata - pierde actualizari, dar fara UB)
+ * - atomic:  fetch_add pe un singur std::atomic (linia de cache sare intre core-uri)
+ * - mutex:   std::mutex + lock_guard
+ * - striped: StripedCounter (slot per thread, fetch_add relaxed)
+ *
+ * Raportam milioane de incrementari pe secunda si valoarea finala obtinuta.
+ *
+ * Utilizare: bench_counter [incrementari_per_thread]
+ */
+
+namespace {
+
+template <typename Increment>
+double run(int threads, long perThread, Increment increment) {
+    bench::Stopwatch timer;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (long i = 0; i < perThread; ++i) {
+                increment();
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    return static_cast<double>(perThread) * threads / timer.seconds() / 1e6;
+}
+
+void cell(double mops, uint64_t value, uint64_t expected) {
+    std::cout << std::right << std::setw(12) << std::fixed << std::setprecision(1) << mops
+              << (value == expected ? "  " : " !");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long perThread = argc > 1 ? std::atol(argv[1]) : 5000000;
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (maxThreads < 8) maxThreads = 8;
+
+    std::cout << "Mops/sec, " << perThread << " incrementari per thread"
+              << " ('!' = valoare finala gresita)\n\n";
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::right << std::setw(14) << "unsafe" << std::setw(14) << "atomic"
+              << std::setw(14) << "mutex" << std::setw(14) << "striped" << "\n";
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        uint64_t expected = static_cast<uint64_t>(perThread) * threads;
+        std::cout << std::left << std::setw(10) << threads;
+
+        std::atomic<uint64_t> unsafeValue(0);
+        double mops = run(threads, perThread, [&]() {
+            unsafeValue.store(unsafeValue.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        });
+        cell(mops, unsafeValue.load(), expected);
+
+        std::atomic<uint64_t> atomicValue(0);
+        mops = run(threads, perThread, [&]() { atomicValue++; });
+        cell(mops, atomicValue.load(), expected);
+
+        std::mutex mtx;
+        uint64_t mutexValue = 0;
+        mops = run(threads, perThread, [&]() {
+            std::lock_guard<std::mutex> lock(mtx);
+            mutexValue++;
+        });
+        cell(mops, mutexValue, expected);
+
+        StripedCounter striped;
+        mops = run(threads, perThread, [&]() { striped.increment(); });
+        cell(mops, striped.load(), expected);
+
+        std::cout << std::endl;
+    }
+    return 0;
+}
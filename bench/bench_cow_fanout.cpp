@@ -0,0 +1,81 @@
+#include "ResourceManager.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * Benchmark: fan-out al unui buffer mare catre multi consumatori
+ *
+ * - MemoryBlock:    fiecare consumator primeste o copie (deep copy, O(size))
+ * - CowMemoryBlock: copiile partajeaza buffer-ul (O(1)); doar consumatorii
+ *                   care scriu isi fac copia proprie
+ *
+ * "writers" dintre consumatori modifica un element. Masuram o data doar
+ * distributia copiilor si o data cu fiecare consumator citind tot buffer-ul.
+ *
+ * Utilizare: bench_cow_fanout [elemente] [consumatori] [writers]
+ */
+
+namespace {
+
+void row(const char* name, size_t rounds, double seconds) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << seconds * 1e6 / static_cast<double>(rounds) << " us/fan-out" << std::endl;
+}
+
+template <typename Block, typename Write>
+double fanOut(const Block& source, size_t consumers, size_t writers, size_t rounds, bool read, int64_t& checksum,
+              Write write) {
+    bench::Stopwatch timer;
+    for (size_t r = 0; r < rounds; ++r) {
+        std::vector<Block> copies(consumers, source);
+        for (size_t c = 0; c < writers && c < consumers; ++c) {
+            write(copies[c], static_cast<int>(r));
+        }
+        if (read) {
+            for (const Block& copy : copies) {
+                checksum += copy.sum();
+            }
+        } else {
+            checksum += copies.back()[copies.back().getSize() - 1];
+        }
+    }
+    return timer.seconds();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t elements = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : (1u << 20);
+    size_t consumers = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 16;
+    size_t writers = argc > 3 ? static_cast<size_t>(std::atol(argv[3])) : 1;
+    const size_t rounds = 20;
+
+    std::cout << elements << " elemente (" << elements * sizeof(int) / 1024 << " KiB), " << consumers
+              << " consumatori, " << writers << " scriu\n\n";
+
+    MemoryBlock deep(elements);
+    deep.transformAffine(1, 3);
+    CowMemoryBlock cow(elements);
+    cow.transformAffine(1, 3);
+
+    auto writeDeep = [](MemoryBlock& b, int v) { b[0] = v; };
+    auto writeCow = [](CowMemoryBlock& b, int v) { b.set(0, v); };
+    int64_t deepSum = 0;
+    int64_t cowSum = 0;
+    row("MemoryBlock (deep)", rounds, fanOut(deep, consumers, writers, rounds, false, deepSum, writeDeep));
+    row("CowMemoryBlock", rounds, fanOut(cow, consumers, writers, rounds, false, cowSum, writeCow));
+    std::cout << "\ncu citirea intregului buffer de catre fiecare consumator:\n";
+    row("MemoryBlock (deep)", rounds, fanOut(deep, consumers, writers, rounds, true, deepSum, writeDeep));
+    row("CowMemoryBlock", rounds, fanOut(cow, consumers, writers, rounds, true, cowSum, writeCow));
+
+    if (deepSum != cowSum) {
+        std::cerr << "Sume diferite: " << deepSum << " vs " << cowSum << std::endl;
+        return 1;
+    }
+    std::cout << "\n(" << cowSum << ")" << std::endl;
+    return 0;
+}
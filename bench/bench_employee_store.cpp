@@ -0,0 +1,116 @@
+#include "EmployeeStore.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <random>
+
+/**
+ * Benchmark: EmployeeStore (coloane) vs obiecte Employee
+ *
+ * - baseline: std::vector<std::unique_ptr<Employee>> (obiecte imprastiate pe
+ *   heap), cu getDepartment() prin valoare si cu getDepartmentView()
+ * - store:    EmployeeStore cu N angajati (implicit 10M)
+ *
+ * Raportam timpul si latimea de banda efectiva (bytes din coloane / secunda).
+ *
+ * Utilizare: bench_employee_store [angajati_store] [angajati_obiecte]
+ */
+
+namespace {
+
+const char* kDepartments[] = {"Engineering", "HR", "Finance", "Sales", "Marketing", "IT", "Legal", "Support"};
+
+template <typename Body>
+double timeIt(Body body, int repeats = 5) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        bench::Stopwatch timer;
+        body();
+        double t = timer.seconds();
+        if (t < best) best = t;
+    }
+    return best;
+}
+
+void row(const char* name, double seconds, double bytes, double checksum) {
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed
+              << std::setw(10) << std::setprecision(2) << seconds * 1e3 << " ms"
+              << std::setw(10) << std::setprecision(1) << bytes / seconds / 1e9 << " GB/s"
+              << "   (" << std::setprecision(0) << checksum << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t storeCount = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 10000000;
+    size_t objectCount = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 1000000;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> ageDist(18, 65);
+    std::uniform_real_distribution<double> salaryDist(30000.0, 150000.0);
+    std::uniform_int_distribution<int> deptDist(0, 7);
+
+    EmployeeStore store;
+    store.reserve(storeCount);
+    for (size_t i = 0; i < storeCount; ++i) {
+        store.add("E" + std::to_string(i), ageDist(rng), salaryDist(rng), kDepartments[deptDist(rng)]);
+    }
+
+    std::vector<std::unique_ptr<Employee>> objects;
+    objects.reserve(objectCount);
+    for (size_t i = 0; i < objectCount; ++i) {
+        objects.push_back(std::make_unique<Employee>("Name", ageDist(rng), "Address",
+                                                     "E" + std::to_string(i), salaryDist(rng),
+                                                     kDepartments[deptDist(rng)]));
+    }
+
+    std::cout << "store: " << storeCount << " angajati, obiecte: " << objectCount << " angajati\n\n";
+
+    // --- Obiecte ---
+    double objSum = 0;
+    double t = timeIt([&]() {
+        objSum = 0;
+        for (const auto& e : objects) objSum += e->getSalary();
+    });
+    row("obiecte: suma salarii", t, static_cast<double>(objectCount) * sizeof(double), objSum);
+
+    t = timeIt([&]() {
+        objSum = 0;
+        for (const auto& e : objects) {
+            if (e->getDepartment() == "IT") objSum += e->getSalary();
+        }
+    });
+    row("obiecte: suma salarii IT", t, static_cast<double>(objectCount) * (sizeof(double) + 4), objSum);
+
+    t = timeIt([&]() {
+        objSum = 0;
+        for (const auto& e : objects) {
+            if (e->getDepartmentView() == "IT") objSum += e->getSalary();
+        }
+    });
+    row("obiecte: suma salarii IT (view)", t, static_cast<double>(objectCount) * (sizeof(double) + 4), objSum);
+
+    // --- Coloane ---
+    double sum = 0;
+    t = timeIt([&]() { sum = store.totalSalary(); });
+    row("store: suma salarii", t, static_cast<double>(storeCount) * sizeof(double), sum);
+
+    uint32_t it = store.findDepartment("IT");
+    t = timeIt([&]() { sum = store.totalSalary(it); });
+    row("store: suma salarii IT", t, static_cast<double>(storeCount) * (sizeof(double) + 4), sum);
+
+    size_t matches = 0;
+    t = timeIt([&]() { matches = store.countByAge(30, 40); });
+    row("store: count 30 <= age <= 40", t, static_cast<double>(storeCount) * 4, static_cast<double>(matches));
+
+    t = timeIt([&]() { matches = store.filterByAge(30, 40).size(); });
+    row("store: filter 30 <= age <= 40", t, static_cast<double>(storeCount) * 8, static_cast<double>(matches));
+
+    std::vector<double> groups;
+    t = timeIt([&]() { groups = store.salaryByDepartment(); });
+    row("store: group-by departament", t, static_cast<double>(storeCount) * (sizeof(double) + 4), groups[0]);
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "ResourceManager.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: FileHandle::readAll (getline + concatenare) vs mapAll/mappedLines
+ *
+ * Genereaza un fisier text de N MiB, apoi il parcurge linie cu linie in
+ * ambele moduri. Raportam MiB/s; a doua trecere ruleaza din page cache.
+ *
+ * Utilizare: bench_file_handle_read [MiB]
+ */
+
+namespace {
+
+const char* kBenchFile = "bench_file_handle_read.txt";
+
+void generate(size_t mebibytes) {
+    std::ofstream out(kBenchFile, std::ios::trunc | std::ios::binary);
+    const std::string line = "2026-01-01T00:00:00Z INFO ingest worker=7 bytes=4096 status=ok\n";
+    size_t target = mebibytes << 20;
+    for (size_t written = 0; written < target; written += line.size()) {
+        out << line;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t mebibytes = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 256;
+    generate(mebibytes);
+
+    for (int pass = 1; pass <= 2; ++pass) {
+        size_t lines = 0;
+        size_t bytes = 0;
+        double seconds = 0;
+        {
+            bench::CoutSilencer silence;
+            FileHandle file(kBenchFile, std::ios::in);
+            bench::Stopwatch timer;
+            std::string content = file.readAll();
+            for (std::string_view line : LineRange(content)) {
+                ++lines;
+                bytes += line.size();
+            }
+            seconds = timer.seconds();
+        }
+        std::cout << "pass " << pass << "  readAll:     " << std::setw(8) << std::fixed << std::setprecision(0)
+                  << static_cast<double>(mebibytes) / seconds << " MiB/s  (" << lines << " linii)" << std::endl;
+
+        lines = 0;
+        bytes = 0;
+        {
+            bench::CoutSilencer silence;
+            FileHandle file(kBenchFile, std::ios::in);
+            bench::Stopwatch timer;
+            for (std::string_view line : file.mappedLines()) {
+                ++lines;
+                bytes += line.size();
+            }
+            seconds = timer.seconds();
+        }
+        std::cout << "pass " << pass << "  mappedLines: " << std::setw(8) << std::fixed << std::setprecision(0)
+                  << static_cast<double>(mebibytes) / seconds << " MiB/s  (" << lines << " linii, "
+                  << bytes << " bytes)" << std::endl;
+    }
+
+    std::remove(kBenchFile);
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "ResourceManager.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: scriere secventiala prin FileHandle
+ *
+ * - write():           calea veche, cu diagnostic pe std::cout la fiecare apel
+ *                      (consola redirectionata catre null - costul formatarii ramane)
+ * - append() + 1 MiB:  buffer user-space, fara consola
+ * - writev() + 1 MiB:  trei bucati (prefix, payload, '\n') per apel
+ *
+ * Utilizare: bench_file_handle_write [MiB]
+ */
+
+namespace {
+
+const char* kBenchFile = "bench_file_handle_write.txt";
+const std::string kRecord = "2026-01-01T00:00:00Z INFO ingest worker=7 bytes=4096 status=ok\n";
+
+template <typename Body>
+void run(const char* name, size_t mebibytes, Body body) {
+    size_t records = (mebibytes << 20) / kRecord.size();
+    double seconds = 0;
+    {
+        bench::CoutSilencer silence;
+        FileHandle file(kBenchFile, std::ios::out | std::ios::trunc | std::ios::binary);
+        bench::Stopwatch timer;
+        body(file, records);
+        file.flush();
+        seconds = timer.seconds();
+    }
+    std::cout << std::left << std::setw(22) << name << std::right << std::setw(10)
+              << std::fixed << std::setprecision(0)
+              << static_cast<double>(records * kRecord.size()) / (1 << 20) / seconds << " MiB/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t mebibytes = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 256;
+
+    run("write()", mebibytes, [](FileHandle& file, size_t records) {
+        for (size_t i = 0; i < records; ++i) {
+            file.write(kRecord);
+        }
+    });
+
+    run("append() + 1 MiB", mebibytes, [](FileHandle& file, size_t records) {
+        file.setWriteBuffer(1 << 20);
+        for (size_t i = 0; i < records; ++i) {
+            file.append(kRecord);
+        }
+    });
+
+    run("writev() + 1 MiB", mebibytes, [](FileHandle& file, size_t records) {
+        file.setWriteBuffer(1 << 20);
+        std::string_view payload(kRecord.data(), kRecord.size() - 1);
+        for (size_t i = 0; i < records; ++i) {
+            file.writev({"", payload, "\n"});
+        }
+    });
+
+    std::remove(kBenchFile);
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "SmartPointerDemo.hpp"
+#include "AllocCounter.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * Benchmark: Resource (obiect + new int[]) vs InlineResource (o alocare)
+ *
+ * - churn:    creare, citirea ultimului element, distrugere
+ * - traverse: N obiecte vii, suma tuturor elementelor (localitate in cache)
+ *
+ * Raportam ns/obiect si alocari/obiect pentru fiecare layout.
+ *
+ * Utilizare: bench_inline_resource [iteratii] [elemente_per_obiect] [obiecte_vii]
+ */
+
+namespace {
+
+int64_t sink = 0;
+
+void row(const char* name, size_t ops, double seconds, size_t allocs) {
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << seconds * 1e9 / static_cast<double>(ops) << " ns/obiect"
+              << std::setw(8) << std::setprecision(2) << static_cast<double>(allocs) / static_cast<double>(ops)
+              << " alocari/obiect" << std::endl;
+}
+
+template <typename Make>
+void churn(const char* name, size_t iterations, size_t elements, Make make) {
+    size_t before = bench::allocations();
+    bench::Stopwatch timer;
+    for (size_t i = 0; i < iterations; ++i) {
+        auto r = make(elements);
+        sink += r->getData()[elements - 1];
+    }
+    row(name, iterations, timer.seconds(), bench::allocations() - before);
+}
+
+template <typename Make>
+void traverse(const char* name, size_t objects, size_t elements, Make make) {
+    using Handle = decltype(make(elements));
+    std::vector<Handle> live;
+    live.reserve(objects);
+    size_t before = bench::allocations();
+    for (size_t i = 0; i < objects; ++i) {
+        live.push_back(make(elements));
+    }
+    size_t allocs = bench::allocations() - before;
+
+    bench::Stopwatch timer;
+    for (int pass = 0; pass < 10; ++pass) {
+        for (const Handle& r : live) {
+            const int* p = r->getData();
+            for (size_t j = 0; j < r->getSize(); ++j) {
+                sink += p[j];
+            }
+        }
+    }
+    row(name, objects * 10, timer.seconds(), allocs * 10);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 1000000;
+    size_t elements = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 16;
+    size_t objects = argc > 3 ? static_cast<size_t>(std::atol(argv[3])) : 100000;
+    if (elements == 0) {
+        elements = 1;
+    }
+    logging::setLevel(logging::Level::Off);
+
+    const std::string name = "res";  // incape in SSO: numele nu aloca
+    auto makeUnique = [&name](size_t n) { return std::make_unique<Resource>(name, n); };
+    auto makeShared = [&name](size_t n) { return std::make_shared<Resource>(name, n); };
+    auto inlineUnique = [&name](size_t n) { return InlineResource::createUnique(name, n); };
+    auto inlineShared = [&name](size_t n) { return InlineResource::createShared(name, n); };
+
+    std::cout << "churn: " << iterations << " obiecte x " << elements << " int\n";
+    churn("make_unique<Resource>", iterations, elements, makeUnique);
+    churn("make_shared<Resource>", iterations, elements, makeShared);
+    churn("InlineResource::createUnique", iterations, elements, inlineUnique);
+    churn("InlineResource::createShared", iterations, elements, inlineShared);
+
+    std::cout << "\ntraverse: " << objects << " obiecte vii x " << elements << " int, 10 treceri\n";
+    traverse("make_unique<Resource>", objects, elements, makeUnique);
+    traverse("make_shared<Resource>", objects, elements, makeShared);
+    traverse("InlineResource::createUnique", objects, elements, inlineUnique);
+    traverse("InlineResource::createShared", objects, elements, inlineShared);
+
+    std::cout << "\n(" << sink << ")" << std::endl;
+    return 0;
+}
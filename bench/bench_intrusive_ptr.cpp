@@ -0,0 +1,126 @@
+#include "IntrusivePtr.hpp"
+#include "BenchCommon.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * Benchmark: std::shared_ptr vs IntrusivePtr (atomic / local)
+ *
+ * - create:        make_shared vs makeIntrusive (o alocare in ambele cazuri)
+ * - copy+destroy:  copiere si distrugere a unui handle, pe un singur thread
+ * - shared copy:   N thread-uri copiaza acelasi handle (contor disputat)
+ *
+ * Utilizare: bench_intrusive_ptr [iteratii] [thread-uri]
+ */
+
+namespace {
+
+struct Payload {
+    int value = 1;
+    int other = 0;
+};
+
+struct AtomicNode : RefCounted<AtomicNode, AtomicRefCount> {
+    Payload payload;
+};
+
+struct LocalNode : RefCounted<LocalNode, LocalRefCount> {
+    Payload payload;
+};
+
+std::atomic<int> sink{0};
+
+void row(const char* name, size_t ops, double seconds) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << seconds * 1e9 / static_cast<double>(ops) << " ns/op" << std::endl;
+}
+
+template <typename Make>
+double benchCreate(size_t iterations, Make make) {
+    bench::Stopwatch timer;
+    for (size_t i = 0; i < iterations; ++i) {
+        auto p = make();
+        sink.fetch_add(p->payload.value, std::memory_order_relaxed);
+    }
+    return timer.seconds();
+}
+
+// Operatiile atomice nu sunt eliminate de compilator; citirea prin copie
+// pastreaza si varianta locala
+template <typename Ptr>
+void copyAndDestroy(size_t iterations, const Ptr& source) {
+    int local = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        Ptr copy = source;
+        local += copy->payload.value;
+    }
+    sink.fetch_add(local, std::memory_order_relaxed);
+}
+
+template <typename Ptr>
+double benchCopy(size_t iterations, const Ptr& source) {
+    bench::Stopwatch timer;
+    copyAndDestroy(iterations, source);
+    return timer.seconds();
+}
+
+template <typename Ptr>
+double benchSharedCopy(size_t iterations, size_t threads, const Ptr& source) {
+    bench::Stopwatch timer;
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&source, iterations]() { copyAndDestroy(iterations, source); });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    return timer.seconds();
+}
+
+struct SharedPayload {
+    Payload payload;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 5000000;
+    size_t threads = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 4;
+
+    // libstdc++ foloseste contoare ne-atomice cat timp procesul are un singur
+    // thread; programele reale (si demo-ul) au mereu mai multe
+    std::thread([]() {}).join();
+
+    std::cout << iterations << " iteratii; sizeof(shared_ptr)=" << sizeof(std::shared_ptr<SharedPayload>)
+              << ", sizeof(IntrusivePtr)=" << sizeof(IntrusivePtr<AtomicNode>) << "\n\n";
+
+    row("create shared_ptr", iterations,
+        benchCreate(iterations, []() { return std::make_shared<SharedPayload>(); }));
+    row("create IntrusivePtr<atomic>", iterations,
+        benchCreate(iterations, []() { return makeIntrusive<AtomicNode>(); }));
+    row("create IntrusivePtr<local>", iterations,
+        benchCreate(iterations, []() { return makeIntrusive<LocalNode>(); }));
+
+    auto shared = std::make_shared<SharedPayload>();
+    auto atomicNode = makeIntrusive<AtomicNode>();
+    auto localNode = makeIntrusive<LocalNode>();
+
+    std::cout << "\n";
+    row("copy+destroy shared_ptr", iterations, benchCopy(iterations, shared));
+    row("copy+destroy IntrusivePtr<atomic>", iterations, benchCopy(iterations, atomicNode));
+    row("copy+destroy IntrusivePtr<local>", iterations, benchCopy(iterations, localNode));
+
+    std::cout << "\n" << threads << " thread-uri copiaza acelasi handle:\n";
+    size_t perThread = iterations / threads;
+    row("shared copy shared_ptr", perThread * threads, benchSharedCopy(perThread, threads, shared));
+    row("shared copy IntrusivePtr<atomic>", perThread * threads, benchSharedCopy(perThread, threads, atomicNode));
+
+    std::cout << "\n(" << sink.load() << ")" << std::endl;
+    return 0;
+}
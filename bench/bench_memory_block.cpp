@@ -0,0 +1,85 @@
+#include "ResourceManager.hpp"
+#include "AllocCounter.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: buffere temporare (scratch) de scurta durata
+ *
+ * In fiecare iteratie se creeaza un bloc de N int-uri, se umple si se
+ * insumeaza, apoi blocul e distrus:
+ * - MemoryBlock             - std::allocator, initializat cu 0
+ * - MemoryBlock neinit.     - std::allocator, fara initializare
+ * - AlignedMemoryBlock      - aliniat la 64 B, fara initializare
+ * - ArenaMemoryBlock        - bump-pointer, Arena::reset() la fiecare 64 de iteratii
+ *
+ * Utilizare: bench_memory_block [iteratii]
+ */
+
+namespace {
+
+template <typename Block>
+long long work(Block& block) {
+    const size_t n = block.getSize();
+    for (size_t i = 0; i < n; ++i) {
+        block[i] = static_cast<int>(i);
+    }
+    long long sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        sum += block[i];
+    }
+    return sum;
+}
+
+template <typename Make>
+void run(const char* name, size_t iterations, Make make) {
+    long long checksum = 0;
+    size_t before = bench::allocations();
+    bench::Stopwatch timer;
+    for (size_t i = 0; i < iterations; ++i) {
+        checksum += make(i);
+    }
+    double ns = timer.seconds() * 1e9 / static_cast<double>(iterations);
+    double allocs = static_cast<double>(bench::allocations() - before) / static_cast<double>(iterations);
+    std::cout << std::left << std::setw(26) << name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << ns << " ns/iter"
+              << std::setprecision(3) << std::setw(10) << allocs << " alocari/iter"
+              << "   (" << checksum << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 2000000;
+
+    for (size_t n : {64, 1024, 16384}) {
+        std::cout << "\nBloc de " << n << " int-uri, " << iterations << " iteratii\n";
+
+        run("MemoryBlock", iterations, [n](size_t) {
+            MemoryBlock block(n);
+            return work(block);
+        });
+
+        run("MemoryBlock neinit.", iterations, [n](size_t) {
+            MemoryBlock block(n, uninitialized);
+            return work(block);
+        });
+
+        run("AlignedMemoryBlock", iterations, [n](size_t) {
+            AlignedMemoryBlock<int> block(n, uninitialized);
+            return work(block);
+        });
+
+        Arena arena(64 * n * sizeof(int) + 4096);
+        run("ArenaMemoryBlock", iterations, [n, &arena](size_t i) {
+            if (i % 64 == 0) {
+                arena.reset();
+            }
+            ArenaMemoryBlock<int> block(n, uninitialized, ArenaAllocator<int>(arena));
+            return work(block);
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "MpscRingBuffer.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <thread>
+
+/**
+ * Benchmark: latenta de hand-off producator -> consumator
+ *
+ * Compara MpscRingBuffer (lock-free, consumator blocant) cu o coada clasica
+ * std::deque + mutex + condition_variable. Producatorii trimit mesaje la
+ * intervale regulate (nu inunda canalul), deci masuram latenta de trezire
+ * si transfer, nu timpul petrecut in coada. Raportam p50/p99 in microsecunde.
+ *
+ * Utilizare: bench_mpsc_ring_buffer [mesaje_per_producator]
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Coada de referinta: mutex + condition_variable
+class MutexQueue {
+private:
+    std::deque<Clock::time_point> items;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool closed = false;
+
+public:
+    void push(Clock::time_point value) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            items.push_back(value);
+        }
+        cv.notify_one();
+    }
+
+    bool pop(Clock::time_point& out) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this] { return closed || !items.empty(); });
+        if (items.empty()) {
+            return false;
+        }
+        out = items.front();
+        items.pop_front();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            closed = true;
+        }
+        cv.notify_all();
+    }
+};
+
+void pace(std::chrono::microseconds interval) {
+    auto until = Clock::now() + interval;
+    while (Clock::now() < until) {
+        std::this_thread::yield();
+    }
+}
+
+template <typename Queue>
+std::vector<double> measure(Queue& queue, int producers, int perProducer) {
+    std::vector<double> latenciesUs;
+    latenciesUs.reserve(static_cast<size_t>(producers) * perProducer);
+
+    std::thread consumer([&]() {
+        Clock::time_point sentAt;
+        while (queue.pop(sentAt)) {
+            latenciesUs.push_back(
+                std::chrono::duration<double, std::micro>(Clock::now() - sentAt).count());
+        }
+    });
+
+    std::vector<std::thread> workers;
+    for (int p = 0; p < producers; ++p) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < perProducer; ++i) {
+                queue.push(Clock::now());
+                pace(std::chrono::microseconds(50));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    queue.close();
+    consumer.join();
+    return latenciesUs;
+}
+
+void report(const char* name, int producers, std::vector<double> samples) {
+    double p50 = bench::percentile(samples, 50.0);
+    double p99 = bench::percentile(samples, 99.0);
+    std::cout << std::left << std::setw(18) << name
+              << std::right << std::setw(10) << producers
+              << std::setw(12) << std::fixed << std::setprecision(1) << p50
+              << std::setw(12) << p99 << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int perProducer = argc > 1 ? std::atoi(argv[1]) : 20000;
+
+    std::cout << "Hand-off latency (us), " << perProducer << " mesaje per producator\n\n";
+    std::cout << std::left << std::setw(18) << "canal"
+              << std::right << std::setw(10) << "producers"
+              << std::setw(12) << "p50" << std::setw(12) << "p99" << "\n";
+
+    for (int producers : {1, 2, 4}) {
+        MpscRingBuffer<Clock::time_point> ring(1024);
+        report("MpscRingBuffer", producers, measure(ring, producers, perProducer));
+
+        MutexQueue locked;
+        report("mutex+condvar", producers, measure(locked, producers, perProducer));
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "SmartPointerDemo.hpp"
+#include "AllocCounter.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/**
+ * Benchmark: creare + distrugere Resource vs imprumut din ObjectPool
+ *
+ * - make_unique: std::make_unique<Resource> si distrugere (2 alocari per ciclu)
+ * - pool:        ObjectPool<Resource>::acquire + returnare in pool (reset hook
+ *                rescrie datele, ca sa fie comparabil cu constructorul)
+ *
+ * Fiecare thread tine cateva resurse "in zbor", ca un handler de cereri.
+ * Raportam ns/ciclu si alocari/ciclu pentru 1..N thread-uri.
+ *
+ * Utilizare: bench_object_pool [cicluri_per_thread] [elemente] [thread-uri_max]
+ */
+
+namespace {
+
+constexpr size_t kInFlight = 4;
+
+std::atomic<int64_t> sink{0};
+
+void row(const char* name, size_t threads, size_t cycles, double seconds, size_t allocs) {
+    std::cout << std::left << std::setw(14) << name << std::right << std::setw(4) << threads << std::fixed
+              << std::setprecision(1) << std::setw(12) << seconds * 1e9 / static_cast<double>(cycles)
+              << " ns/ciclu" << std::setw(8) << std::setprecision(2)
+              << static_cast<double>(allocs) / static_cast<double>(cycles) << " alocari/ciclu" << std::endl;
+}
+
+template <typename Acquire>
+void run(const char* name, size_t threads, size_t cycles, Acquire acquire) {
+    size_t before = bench::allocations();
+    bench::Stopwatch timer;
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&acquire, cycles]() {
+            using Handle = decltype(acquire());
+            std::vector<Handle> inFlight(kInFlight);
+            int64_t local = 0;
+            for (size_t i = 0; i < cycles; ++i) {
+                Handle& slot = inFlight[i % kInFlight];
+                slot = acquire();   // vechea resursa e distrusa / returnata
+                local += slot->getData()[slot->getSize() - 1];
+            }
+            sink.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    row(name, threads, cycles * threads, timer.seconds(), bench::allocations() - before);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t cycles = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 500000;
+    size_t elements = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 16;
+    size_t maxThreads = argc > 3 ? static_cast<size_t>(std::atol(argv[3])) : 8;
+    if (elements == 0) {
+        elements = 1;
+    }
+    logging::setLevel(logging::Level::Off);
+
+    ObjectPool<Resource> pool([elements]() { return std::make_unique<Resource>("res", elements); },
+                              [](Resource& r) { r.resetData(); });
+
+    std::cout << cycles << " cicluri per thread, Resource cu " << elements << " int, " << kInFlight
+              << " in zbor per thread\n\n";
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        run("make_unique", threads, cycles, [elements]() { return std::make_unique<Resource>("res", elements); });
+        run("ObjectPool", threads, cycles, [&pool]() { return pool.acquire(); });
+    }
+
+    ObjectPoolStats stats = pool.stats();
+    std::cout << "\nPool: " << stats.created << " create, " << stats.reused << " refolosite, " << stats.discarded
+              << " sterse, " << stats.idle << " libere" << std::endl;
+    std::cout << "(" << sink.load() << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include "Employee.hpp"
+#include "AllocCounter.hpp"
+#include "BenchCommon.hpp"
+
+#include <iomanip>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Benchmark: alocari per copiere pentru Person/Employee
+ *
+ * LegacyEmployee reproduce layout-ul vechi (std::string* address/department,
+ * "new std::string" la fiecare copiere) pentru comparatie directa cu
+ * Employee, care tine stringurile inline si are move semantics.
+ *
+ * Doua seturi de date: stringuri scurte (incap in SSO) si lungi (pe heap).
+ * La final: realocarea unui std::vector<Employee> (move noexcept, fara copii).
+ */
+
+namespace {
+
+// Layout-ul vechi, fara logging
+struct LegacyPerson {
+    std::string name;
+    int age;
+    std::string* address;
+
+    LegacyPerson(const std::string& n, int a, const std::string& addr)
+        : name(n), age(a), address(new std::string(addr)) {}
+    LegacyPerson(const LegacyPerson& o) : name(o.name), age(o.age), address(new std::string(*o.address)) {}
+    LegacyPerson& operator=(const LegacyPerson& rhs) {
+        if (this != &rhs) {
+            name = rhs.name;
+            age = rhs.age;
+            delete address;
+            address = new std::string(*rhs.address);
+        }
+        return *this;
+    }
+    ~LegacyPerson() { delete address; }
+};
+
+struct LegacyEmployee : LegacyPerson {
+    std::string employeeId;
+    double salary;
+    std::string* department;
+
+    LegacyEmployee(const std::string& n, int a, const std::string& addr,
+                   const std::string& id, double sal, const std::string& dept)
+        : LegacyPerson(n, a, addr), employeeId(id), salary(sal), department(new std::string(dept)) {}
+    LegacyEmployee(const LegacyEmployee& o)
+        : LegacyPerson(o), employeeId(o.employeeId), salary(o.salary), department(new std::string(*o.department)) {}
+    LegacyEmployee& operator=(const LegacyEmployee& rhs) {
+        if (this != &rhs) {
+            LegacyPerson::operator=(rhs);
+            employeeId = rhs.employeeId;
+            salary = rhs.salary;
+            delete department;
+            department = new std::string(*rhs.department);
+        }
+        return *this;
+    }
+    ~LegacyEmployee() { delete department; }
+};
+
+struct Sample {
+    const char* label;
+    std::string name, address, id, department;
+};
+
+template <typename T>
+void measure(const char* type, const Sample& s) {
+    const int iterations = 100000;
+    T source(s.name, 30, s.address, s.id, 50000.0, s.department);
+    T target(s.name, 31, s.address, s.id, 40000.0, s.department);
+
+    size_t before = bench::allocations();
+    bench::Stopwatch copyTimer;
+    for (int i = 0; i < iterations; ++i) {
+        T copy(source);
+        (void)copy;
+    }
+    double copyNs = copyTimer.seconds() * 1e9 / iterations;
+    double copyAllocs = static_cast<double>(bench::allocations() - before) / iterations;
+
+    before = bench::allocations();
+    bench::Stopwatch assignTimer;
+    for (int i = 0; i < iterations; ++i) {
+        target = source;
+    }
+    double assignNs = assignTimer.seconds() * 1e9 / iterations;
+    double assignAllocs = static_cast<double>(bench::allocations() - before) / iterations;
+
+    std::cout << std::left << std::setw(16) << type << std::setw(8) << s.label
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << copyAllocs << std::setw(12) << copyNs
+              << std::setw(14) << assignAllocs << std::setw(12) << assignNs << std::endl;
+}
+
+void measureMove(const Sample& s) {
+    const int iterations = 100000;
+    Employee source(s.name, 30, s.address, s.id, 50000.0, s.department);
+
+    size_t before = bench::allocations();
+    for (int i = 0; i < iterations; ++i) {
+        Employee moved(std::move(source));
+        source = std::move(moved);
+    }
+    double allocs = static_cast<double>(bench::allocations() - before) / iterations;
+    std::cout << "Employee " << s.label << ": " << allocs << " alocari per move ctor + move assign" << std::endl;
+}
+
+// Realocarea unui vector: cu move noexcept, singura alocare este noul buffer
+void measureRelocation(const Sample& s) {
+    const size_t count = 1000000;
+    std::vector<Employee> employees;
+    employees.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        employees.emplace_back(s.name, 30, s.address, s.id, 50000.0, s.department);
+    }
+
+    size_t before = bench::allocations();
+    bench::Stopwatch timer;
+    employees.reserve(count * 2);
+    double ms = timer.seconds() * 1e3;
+    std::cout << "vector<Employee> " << s.label << ": realocare " << count << " elemente -> "
+              << (bench::allocations() - before) << " alocari, " << ms << " ms" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    const Sample shortStrings{"scurt", "Emma", "Broadway 5", "EMP001", "IT"};
+    const Sample longStrings{"lung", "Emma Elizabeth Smith-Johnson",
+                             "555 Broadway Avenue, Apartment 12B, New York",
+                             "EMPLOYEE-2026-000000000001", "Engineering / Platform Infrastructure"};
+
+    std::cout << std::left << std::setw(16) << "tip" << std::setw(8) << "date"
+              << std::right << std::setw(12) << "alloc/copy" << std::setw(12) << "ns/copy"
+              << std::setw(14) << "alloc/assign" << std::setw(12) << "ns/assign" << "\n";
+
+    for (const Sample* s : {&shortStrings, &longStrings}) {
+        measure<LegacyEmployee>("LegacyEmployee", *s);
+        measure<Employee>("Employee", *s);
+    }
+
+    std::cout << "\n";
+    measureMove(shortStrings);
+    measureMove(longStrings);
+    measureRelocation(longStrings);
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "ResourceManager.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: debit de interogari pe O SINGURA conexiune, round-trip 100 us
+ *
+ * - sync:     executeQuery, o interogare per round-trip
+ * - batch N:  executeBatch cu un prepared statement; N interogari in zbor,
+ *             apoi asteptam toate future-urile
+ *
+ * Debitul ar trebui sa creasca aproximativ liniar cu N pana cand costul
+ * local (render + future + dispatcher) devine dominant.
+ *
+ * Utilizare: bench_query_pipeline [interogari]
+ */
+
+int main(int argc, char** argv) {
+    int total = argc > 1 ? std::atoi(argv[1]) : 20000;
+    logging::setLevel(logging::Level::Off);
+
+    SimulatedDatabaseServer server;
+    DatabaseConnection db("localhost:5432/bench", &server);
+    PreparedStatement select = DatabaseConnection::prepare("SELECT * FROM orders WHERE id = ?");
+
+    std::cout << "Round-trip " << server.getOptions().roundTrip.count() << " us, " << total
+              << " interogari\n\n";
+    std::cout << std::left << std::setw(14) << "mod" << std::right << std::setw(14) << "interogari/s" << "\n";
+
+    int syncCount = std::min(total, 2000);
+    bench::Stopwatch timer;
+    for (int i = 0; i < syncCount; ++i) {
+        db.executeQuery("SELECT * FROM orders WHERE id = '" + std::to_string(i) + "'");
+    }
+    std::cout << std::left << std::setw(14) << "sync" << std::right << std::fixed << std::setprecision(0)
+              << std::setw(14) << syncCount / timer.seconds() << std::endl;
+
+    for (int batch : {1, 4, 16, 64, 256, 1024}) {
+        std::vector<std::vector<std::string>> rows(batch);
+        size_t answered = 0;
+        bench::Stopwatch batchTimer;
+        for (int done = 0; done < total; done += batch) {
+            for (int i = 0; i < batch; ++i) {
+                rows[i] = {std::to_string(done + i)};
+            }
+            for (auto& result : db.executeBatch(select, rows)) {
+                answered += result.get().size() > 0;
+            }
+        }
+        std::cout << std::left << std::setw(14) << ("batch " + std::to_string(batch)) << std::right
+                  << std::setw(14) << static_cast<double>(answered) / batchTimer.seconds() << std::endl;
+    }
+
+    std::cout << "\nInterogari executate pe server: " << server.queryCount() << std::endl;
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include "RecordFormat.hpp"
+#include "Logger.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * Benchmark: incarcarea a N angajati dintr-un fisier text vs format binar
+ *
+ * - text:    linii "name,age,address,id,salary,department", citite prin
+ *            MappedFile + LineIterator si parsate cu strtol/strtod
+ * - binar:   RecordWriter la scriere; la citire RecordReader (mmap) +
+ *            loadEmployees, plus o scanare fara copiere (suma salariilor)
+ *
+ * Ambele incarca in acelasi EmployeeStore. Raportam secunde, Mrecord/s si
+ * timpul estimat pentru 50M de angajati.
+ *
+ * Utilizare: bench_record_format [angajati]
+ */
+
+namespace {
+
+const char* kTextFile = "bench_record_format.csv";
+const char* kBinaryFile = "bench_record_format.ecpr";
+const char* kDepartments[] = {"IT", "HR", "Finance", "Sales", "Marketing", "Legal", "Operations", "Research"};
+
+void row(const char* name, size_t records, double seconds) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(9) << seconds << " s" << std::setw(10) << std::setprecision(1)
+              << static_cast<double>(records) / seconds / 1e6 << " Mrec/s" << std::setw(10)
+              << seconds * 50e6 / static_cast<double>(records) << " s / 50M" << std::endl;
+}
+
+// Date deterministe, aceleasi pentru ambele formate
+template <typename Sink>
+void generate(size_t count, Sink sink) {
+    std::string name, address, id;
+    for (size_t i = 0; i < count; ++i) {
+        name = "Employee" + std::to_string(i % 100000);
+        address = std::to_string(i % 9973) + " Main St";
+        id = "E" + std::to_string(i);
+        sink(name, static_cast<int>(20 + i % 45), address, id, 30000.0 + static_cast<double>(i % 70000),
+             kDepartments[i % 8]);
+    }
+}
+
+// Urmatorul camp pana la ','; linia ramasa avanseaza dupa separator
+std::string_view nextField(std::string_view& line) {
+    size_t pos = line.find(',');
+    std::string_view field = line.substr(0, pos);
+    line.remove_prefix(pos == std::string_view::npos ? line.size() : pos + 1);
+    return field;
+}
+
+size_t loadText(EmployeeStore& store) {
+    MappedFile file(kTextFile);
+    size_t count = 0;
+    std::string number;
+    for (std::string_view line : LineRange(file.view())) {
+        nextField(line);   // name
+        number.assign(nextField(line));
+        int age = static_cast<int>(std::strtol(number.c_str(), nullptr, 10));
+        nextField(line);   // address
+        std::string_view id = nextField(line);
+        number.assign(nextField(line));
+        double salary = std::strtod(number.c_str(), nullptr);
+        store.add(id, age, salary, nextField(line));
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 2000000;
+    logging::setLevel(logging::Level::Off);
+    std::cout << count << " angajati\n\n";
+
+    {
+        bench::Stopwatch timer;
+        std::ofstream out(kTextFile, std::ios::trunc | std::ios::binary);
+        generate(count, [&out](std::string_view name, int age, std::string_view address, std::string_view id,
+                               double salary, std::string_view department) {
+            out << name << ',' << age << ',' << address << ',' << id << ',' << salary << ',' << department << '\n';
+        });
+        out.close();
+        row("text: scriere", count, timer.seconds());
+    }
+    {
+        bench::Stopwatch timer;
+        RecordWriter writer(kBinaryFile, RecordKind::Employee);
+        generate(count, [&writer](std::string_view name, int age, std::string_view address, std::string_view id,
+                                  double salary, std::string_view department) {
+            writer.writeEmployee(name, age, address, id, salary, department);
+        });
+        writer.close();
+        row("binar: scriere", count, timer.seconds());
+    }
+
+    double textTotal = 0;
+    double binaryTotal = 0;
+    {
+        bench::Stopwatch timer;
+        EmployeeStore store;
+        store.reserve(count);
+        size_t loaded = loadText(store);
+        row("text: parsare + store", loaded, timer.seconds());
+        textTotal = store.totalSalary();
+    }
+    {
+        bench::Stopwatch timer;
+        RecordReader reader(kBinaryFile);
+        EmployeeStore store;
+        size_t loaded = loadEmployees(reader, store);
+        row("binar: mmap + store", loaded, timer.seconds());
+        binaryTotal = store.totalSalary();
+    }
+    {
+        bench::Stopwatch timer;
+        RecordReader reader(kBinaryFile);
+        double total = 0;
+        size_t nameBytes = 0;
+        for (size_t b = 0; b < reader.blockCount(); ++b) {
+            const RecordBlock& block = reader.block(b);
+            for (size_t i = 0; i < block.size(); ++i) {
+                total += block.salary(i);
+                nameBytes += block.name(i).size();
+            }
+        }
+        row("binar: scanare zero-copy", reader.size(), timer.seconds());
+        std::cout << "\n(" << nameBytes << " bytes de nume)" << std::endl;
+        if (total != binaryTotal) {
+            std::cout << "Sume diferite intre scanare si store!" << std::endl;
+        }
+    }
+
+    std::cout << "Total salarii: text $" << textTotal << ", binar $" << binaryTotal << std::endl;
+    std::remove(kTextFile);
+    std::remove(kBinaryFile);
+    return textTotal == binaryTotal ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+#include "ResourceManager.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <random>
+
+/**
+ * Benchmark: kernel-uri MemoryBlock pe N int-uri (implicit 16M = 64 MiB)
+ *
+ * - fill / sum / minMax / transformAffine pentru fiecare varianta
+ *   (Scalar, SSE2, AVX2 - doar cele suportate de CPU)
+ * - suma prin operator[] (verificat) vs pointeri (neverificat)
+ * - deep copy: copy constructor / operator= (memcpy intern) vs memcpy direct
+ *
+ * Rezultatul fiecarui kernel e afisat, ca variantele sa poata fi comparate.
+ *
+ * Utilizare: bench_simd_kernels [elemente]
+ */
+
+namespace {
+
+template <typename Body>
+double best(Body body, int repeats = 5) {
+    double result = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        bench::Stopwatch timer;
+        body();
+        double t = timer.seconds();
+        if (t < result) result = t;
+    }
+    return result;
+}
+
+void row(const std::string& name, double seconds, double bytes, long long check) {
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed
+              << std::setw(9) << std::setprecision(2) << seconds * 1e3 << " ms"
+              << std::setw(9) << std::setprecision(1) << bytes / seconds / 1e9 << " GB/s"
+              << "   (" << check << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 16 * 1024 * 1024;
+    const double bytes = static_cast<double>(n) * sizeof(int);
+
+    MemoryBlock block(n, uninitialized);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(-1000000, 1000000);
+    for (int& x : block) {
+        x = dist(rng);
+    }
+    MemoryBlock work(n, uninitialized);
+
+    std::cout << n << " int-uri, CPU: " << simd::isaName(simd::detectIsa()) << "\n\n";
+
+    for (simd::Isa isa : {simd::Isa::Scalar, simd::Isa::SSE2, simd::Isa::AVX2}) {
+        if (simd::useIsa(isa) != isa) {
+            continue;
+        }
+        std::string tag = std::string("[") + simd::isaName(isa) + "] ";
+
+        double t = best([&]() { work.fill(42); });
+        row(tag + "fill", t, bytes, work[n - 1]);
+
+        long long s = 0;
+        t = best([&]() { s = block.sum(); });
+        row(tag + "sum", t, bytes, s);
+
+        std::pair<int, int> mm;
+        t = best([&]() { mm = block.minMax(); });
+        row(tag + "minMax", t, bytes, static_cast<long long>(mm.first) * 10000000 + mm.second);
+
+        t = best([&]() { simd::transformAffine(work.getData(), block.getData(), n, 3, 7); });
+        row(tag + "transformAffine", t, 2 * bytes, simd::sum(work.getData(), n));
+    }
+    simd::useIsa(simd::detectIsa());
+
+    std::cout << std::endl;
+    long long s = 0;
+    double t = best([&]() {
+        s = 0;
+        for (size_t i = 0; i < block.getSize(); ++i) s += block[i];
+    });
+    row("sum prin operator[]", t, bytes, s);
+
+    t = best([&]() {
+        s = 0;
+        for (int x : block) s += x;
+    });
+    row("sum prin begin()/end()", t, bytes, s);
+
+    std::cout << std::endl;
+    long long sink = 0;
+    t = best([&]() {
+        MemoryBlock copy(block);
+        sink += copy[n - 1];
+    });
+    row("copy: MemoryBlock(const&)", t, 2 * bytes, sink / 5);
+
+    t = best([&]() { work = block; });
+    row("copy: operator=", t, 2 * bytes, work[n - 1]);
+
+    t = best([&]() { std::memcpy(work.getData(), block.getData(), n * sizeof(int)); });
+    row("copy: memcpy", t, 2 * bytes, work[n - 1]);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "Employee.hpp"
+#include "SlabPool.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <thread>
+
+/**
+ * Benchmark: creare/distrugere de Employee de scurta durata
+ *
+ * - slab:   new/delete -> Employee::operator new/delete -> SlabPool<Employee>
+ * - malloc: ::new/::delete ocolesc operatorii clasei (heap-ul general)
+ *
+ * Fiecare thread creeaza loturi de 256 de obiecte si apoi le distruge.
+ * Stringurile sunt scurte (SSO), deci singura alocare este obiectul.
+ *
+ * Utilizare: bench_slab_pool [obiecte_per_thread]
+ */
+
+namespace {
+
+constexpr size_t kBatch = 256;
+
+template <bool UsePool>
+double run(int threads, size_t perThread) {
+    bench::Stopwatch timer;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([perThread]() {
+            Employee* batch[kBatch];
+            for (size_t done = 0; done < perThread; done += kBatch) {
+                for (size_t i = 0; i < kBatch; ++i) {
+                    batch[i] = UsePool ? new Employee("Ana", 30, "", "E1", 1000.0, "IT")
+                                       : ::new Employee("Ana", 30, "", "E1", 1000.0, "IT");
+                }
+                for (size_t i = 0; i < kBatch; ++i) {
+                    if (UsePool) {
+                        delete batch[i];
+                    } else {
+                        ::delete batch[i];
+                    }
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    return static_cast<double>(perThread) * threads / timer.seconds() / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t perThread = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 10000000;
+
+    std::cout << "Milioane de create+destroy Employee pe secunda, "
+              << perThread << " per thread\n\n";
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::right << std::setw(12) << "malloc" << std::setw(12) << "slab" << "\n";
+
+    for (int threads : {1, 2, 4, 8}) {
+        double heap = run<false>(threads, perThread);
+        double pool = run<true>(threads, perThread);
+        std::cout << std::left << std::setw(10) << threads << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(12) << heap << std::setw(12) << pool << std::endl;
+    }
+
+    SlabPoolStats s = SlabPool<Employee>::stats();
+    std::cout << "\nSlabPool<Employee>: block " << s.blockSize << " B, " << s.slabs << " slab-uri ("
+              << s.bytesReserved / 1024 << " KiB), " << s.allocations << " alocari, "
+              << s.deallocations << " eliberari, " << s.globalRefills << " refill-uri, "
+              << s.globalReturns << " returnari, " << s.fallbacks << " fallback-uri" << std::endl;
+    return 0;
+}
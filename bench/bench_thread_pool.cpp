@@ -0,0 +1,78 @@
+#include "ThreadPool.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * Benchmark: costul lansarii unui task scurt
+ *
+ * - std::thread:    un thread nou per task (create + join), ca in demo-urile vechi
+ * - pool submit:    ThreadPool::submit + future.get() pentru fiecare task
+ * - parallel_for:   acelasi numar de iteratii, impartite in bucati de pool
+ *
+ * Task-ul insumeaza cateva numere (de ordinul zecilor de ns de lucru util).
+ *
+ * Utilizare: bench_thread_pool [task-uri] [thread-uri_pool]
+ */
+
+namespace {
+
+std::atomic<uint64_t> sink{0};
+
+void tinyTask(uint64_t seed) {
+    uint64_t x = seed;
+    for (int i = 0; i < 16; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    sink.fetch_add(x & 1, std::memory_order_relaxed);
+}
+
+void row(const char* name, size_t tasks, double seconds) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << seconds * 1e9 / static_cast<double>(tasks) << " ns/task" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t tasks = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 200000;
+    size_t threads = argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : 4;
+
+    std::cout << tasks << " task-uri, pool cu " << threads << " thread-uri\n\n";
+
+    // Thread-urile sunt scumpe: masuram pe mai putine task-uri
+    size_t threadTasks = std::min<size_t>(tasks, 20000);
+    bench::Stopwatch timer;
+    for (size_t i = 0; i < threadTasks; i += threads) {
+        std::vector<std::thread> batch;
+        for (size_t t = 0; t < threads && i + t < threadTasks; ++t) {
+            batch.emplace_back(tinyTask, i + t);
+        }
+        for (auto& th : batch) {
+            th.join();
+        }
+    }
+    row("std::thread", threadTasks, timer.seconds());
+
+    ThreadPool pool(threads);
+
+    timer = bench::Stopwatch();
+    std::vector<std::future<void>> futures;
+    futures.reserve(tasks);
+    for (size_t i = 0; i < tasks; ++i) {
+        futures.push_back(pool.submit(tinyTask, static_cast<uint64_t>(i)));
+    }
+    for (auto& f : futures) {
+        f.get();
+    }
+    row("pool submit", tasks, timer.seconds());
+
+    timer = bench::Stopwatch();
+    pool.parallel_for(size_t{0}, tasks, [](size_t i) { tinyTask(i); });
+    row("parallel_for", tasks, timer.seconds());
+
+    std::cout << "\n(" << sink.load() << ")" << std::endl;
+    return 0;
+}
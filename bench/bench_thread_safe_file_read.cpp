@@ -0,0 +1,104 @@
+#include "ThreadingDemo.hpp"
+#include "BenchCommon.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+
+/**
+ * Benchmark: citiri concurente din ThreadSafeFile in timp ce un writer scrie
+ *
+ * - exclusive: fiecare citire tine fileMutex (getMutex()), ca inainte de
+ *              pread - cititorii se serializeaza intre ei si cu writer-ul
+ * - pread:     readSync direct, fara lock, pe lungimea publicata
+ *
+ * Un singur writer apeleaza writeSync continuu; 1..N cititori citesc tot
+ * fisierul in bucla pentru o durata fixa. Raportam citiri/sec si scrieri/sec.
+ *
+ * Utilizare: bench_thread_safe_file_read [ms_per_rulare] [linii_initiale]
+ */
+
+namespace {
+
+const char* kBenchFile = "bench_thread_safe_file_read.txt";
+
+struct Result {
+    double readsPerSec;
+    double writesPerSec;
+};
+
+Result runOnce(bool exclusive, int readers, int durationMs, int initialLines) {
+    ThreadSafeFile file(kBenchFile);
+    const std::string payload = "payload de test pentru benchmark-ul de citire";
+    for (int i = 0; i < initialLines; ++i) {
+        file.writeSync(payload, 0);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    uint64_t writes = 0;
+    std::atomic<uint64_t> bytesSeen{0};
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            file.writeSync(payload, 1);
+            ++writes;
+        }
+    });
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r]() {
+            uint64_t local = 0;
+            uint64_t bytes = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (exclusive) {
+                    std::lock_guard<std::mutex> lock(file.getMutex());
+                    bytes += file.readSync(r + 2).size();
+                } else {
+                    bytes += file.readSync(r + 2).size();
+                }
+                ++local;
+            }
+            reads.fetch_add(local, std::memory_order_relaxed);
+            bytesSeen.fetch_add(bytes, std::memory_order_relaxed);
+        });
+    }
+
+    bench::Stopwatch timer;
+    std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+    stop.store(true);
+    for (auto& t : threads) {
+        t.join();
+    }
+    double seconds = timer.seconds();
+
+    if (bytesSeen.load() == 0) {
+        std::cerr << "Nicio citire nu a intors date" << std::endl;
+    }
+    return Result{static_cast<double>(reads.load()) / seconds, static_cast<double>(writes) / seconds};
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int durationMs = argc > 1 ? std::atoi(argv[1]) : 300;
+    int initialLines = argc > 2 ? std::atoi(argv[2]) : 1000;
+    const int readerCounts[] = {1, 2, 4, 8};
+
+    std::cout << "ThreadSafeFile: 1 writer + N cititori, " << durationMs << " ms per rulare, "
+              << initialLines << " linii initiale\n\n";
+    std::cout << std::left << std::setw(10) << "readers"
+              << std::right << std::setw(18) << "exclusive rd/s" << std::setw(18) << "exclusive wr/s"
+              << std::setw(18) << "pread rd/s" << std::setw(18) << "pread wr/s" << "\n";
+
+    for (int readers : readerCounts) {
+        Result locked = runOnce(true, readers, durationMs, initialLines);
+        Result shared = runOnce(false, readers, durationMs, initialLines);
+        std::cout << std::left << std::setw(10) << readers << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(18) << locked.readsPerSec << std::setw(18) << locked.writesPerSec
+                  << std::setw(18) << shared.readsPerSec << std::setw(18) << shared.writesPerSec << std::endl;
+    }
+
+    std::remove(kBenchFile);
+    return 0;
+}
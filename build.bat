@@ -14,7 +14,7 @@ echo Checking for g++...
 where g++ >nul 2>&1
 if %ERRORLEVEL% EQU 0 (
     echo Found g++, compiling with C++17 and threading support...
-    g++ -std=c++17 -I./include -pthread -o build/EffectiveCppDemo.exe src/main.cpp src/Person.cpp src/Employee.cpp src/Widget.cpp
+    g++ -std=c++17 -I./include -pthread -o build/EffectiveCppDemo.exe src/main.cpp src/Person.cpp src/Employee.cpp src/Widget.cpp src/EmployeeStore.cpp src/RecordFormat.cpp
     if %ERRORLEVEL% EQU 0 (
         echo.
         echo ====================================
@@ -0,0 +1,214 @@
+#ifndef ALLOCATORS_HPP
+#define ALLOCATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+ * ============================================================================
+ * Alocatori pentru containere / MemoryBlock
+ * ============================================================================
+ *
+ * - AlignedAllocator<T, Align, HugePages>: memorie aliniata la Align bytes
+ *   (implicit 64 = o linie de cache). Cu HugePages = true, blocurile de cel
+ *   putin 2 MiB sunt aliniate la 2 MiB si marcate cu MADV_HUGEPAGE (Linux),
+ *   ca kernel-ul sa le poata acoperi cu pagini mari (mai putine TLB miss-uri)
+ * - Arena: alocator bump-pointer pentru obiecte cu aceeasi durata de viata
+ *   (ex. buffere temporare dintr-un lot). Alocarea muta un pointer; nu exista
+ *   eliberare individuala - reset() recupereaza totul dintr-o data
+ * - ArenaAllocator<T>: adaptor std-compatibil peste o Arena
+ */
+
+template <typename T, size_t Align = 64, bool HugePages = false>
+class AlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0, "Alinierea trebuie sa fie o putere a lui 2");
+
+public:
+    using value_type = T;
+
+    static constexpr size_t kAlignment = Align < alignof(T) ? alignof(T) : Align;
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Align, HugePages>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align, HugePages>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        size_t bytes = n * sizeof(T);
+        size_t align = alignmentFor(bytes);
+        if (align == kHugePageSize) {
+            bytes = roundToHugePage(bytes);
+        }
+        void* p = ::operator new(bytes, std::align_val_t(align));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (align == kHugePageSize) {
+            madvise(p, bytes, MADV_HUGEPAGE);   // doar un hint; erorile sunt ignorate
+        }
+#endif
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        ::operator delete(p, std::align_val_t(alignmentFor(n * sizeof(T))));
+    }
+
+    friend bool operator==(const AlignedAllocator&, const AlignedAllocator&) noexcept { return true; }
+    friend bool operator!=(const AlignedAllocator&, const AlignedAllocator&) noexcept { return false; }
+
+private:
+    static constexpr size_t alignmentFor(size_t bytes) noexcept {
+        return (HugePages && bytes >= kHugePageSize) ? kHugePageSize : kAlignment;
+    }
+
+    static constexpr size_t roundToHugePage(size_t bytes) noexcept {
+        return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+    }
+};
+
+template <typename T>
+using HugePageAllocator = AlignedAllocator<T, 64, true>;
+
+// ============================================================================
+// Arena: alocare bump-pointer pe chunk-uri
+// ============================================================================
+class Arena {
+private:
+    struct Chunk {
+        char* data;
+        size_t size;
+    };
+
+    static constexpr size_t kChunkAlign = 64;
+
+    std::vector<Chunk> chunks;
+    size_t current = 0;          // chunk-ul din care se aloca acum
+    char* ptr = nullptr;
+    char* end = nullptr;
+    size_t nextChunkSize;
+    size_t used = 0;
+
+    void* allocateSlow(size_t bytes, size_t align) {
+        // Dupa reset(), chunk-urile existente se refolosesc in ordine
+        for (size_t i = chunks.empty() ? 0 : current + 1; i < chunks.size(); ++i) {
+            if (chunks[i].size >= bytes + align) {
+                useChunk(i);
+                return allocate(bytes, align);
+            }
+        }
+        size_t size = nextChunkSize;
+        while (size < bytes + align) {
+            size *= 2;
+        }
+        char* data = static_cast<char*>(::operator new(size, std::align_val_t(kChunkAlign)));
+        chunks.push_back({data, size});
+        nextChunkSize = size * 2;
+        useChunk(chunks.size() - 1);
+        return allocate(bytes, align);
+    }
+
+    void useChunk(size_t index) {
+        current = index;
+        ptr = chunks[index].data;
+        end = ptr + chunks[index].size;
+    }
+
+public:
+    explicit Arena(size_t initialChunkSize = 64 * 1024) : nextChunkSize(initialChunkSize ? initialChunkSize : 1) {}
+
+    ~Arena() {
+        for (const Chunk& c : chunks) {
+            ::operator delete(c.data, std::align_val_t(kChunkAlign));
+        }
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t bytes, size_t align = alignof(std::max_align_t)) {
+        uintptr_t p = (reinterpret_cast<uintptr_t>(ptr) + align - 1) & ~(static_cast<uintptr_t>(align) - 1);
+        if (ptr && p + bytes <= reinterpret_cast<uintptr_t>(end)) {
+            ptr = reinterpret_cast<char*>(p + bytes);
+            used += bytes;
+            return reinterpret_cast<void*>(p);
+        }
+        return allocateSlow(bytes, align);
+    }
+
+    // Elibereaza logic tot ce s-a alocat; memoria ramane rezervata pentru lotul urmator.
+    // Obiectele alocate din arena nu mai au voie sa fie folosite dupa reset().
+    void reset() noexcept {
+        used = 0;
+        if (chunks.empty()) {
+            return;
+        }
+        useChunk(0);
+    }
+
+    size_t bytesUsed() const { return used; }
+
+    size_t bytesReserved() const {
+        size_t total = 0;
+        for (const Chunk& c : chunks) {
+            total += c.size;
+        }
+        return total;
+    }
+
+    size_t chunkCount() const { return chunks.size(); }
+};
+
+template <typename T>
+class ArenaAllocator {
+private:
+    Arena* arena;
+
+    template <typename U>
+    friend class ArenaAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit ArenaAllocator(Arena& a) noexcept : arena(&a) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // Nimic de facut: memoria se recupereaza la Arena::reset()
+    void deallocate(T*, size_t) noexcept {}
+
+    Arena& getArena() const noexcept { return *arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return arena != other.arena; }
+};
+
+#endif // ALLOCATORS_HPP
@@ -0,0 +1,94 @@
+#ifndef ASYNC_EXECUTOR_HPP
+#define ASYNC_EXECUTOR_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * ============================================================================
+ * AsyncExecutor: cateva thread-uri care ruleaza continuari scurte
+ * ============================================================================
+ *
+ * Folosit pentru corutine: cand un raspuns soseste, corutina care il astepta
+ * este reluata (resume) pe unul dintre thread-urile executorului, nu pe
+ * thread-ul care a livrat raspunsul. Mii de cereri in zbor impart astfel
+ * doar cateva thread-uri - niciun thread nu sta blocat in asteptare.
+ *
+ * - post(fn): pune fn in coada; fn trebuie sa fie scurta si sa nu blocheze
+ * - current(): executorul pe al carui thread ruleaza codul (sau nullptr)
+ * - Destructorul ruleaza tot ce a ramas in coada, apoi opreste thread-urile
+ */
+class AsyncExecutor {
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::function<void()>> queue;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    static AsyncExecutor*& currentSlot() {
+        thread_local AsyncExecutor* executor = nullptr;
+        return executor;
+    }
+
+    void workerLoop() {
+        currentSlot() = this;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            ready.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;   // stopping si nimic de rulat
+            }
+            std::function<void()> task = std::move(queue.front());
+            queue.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+public:
+    explicit AsyncExecutor(size_t threads = 4) {
+        if (threads == 0) {
+            threads = 1;
+        }
+        workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            workers.emplace_back(&AsyncExecutor::workerLoop, this);
+        }
+    }
+
+    ~AsyncExecutor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    // notify sub lock: task-ul poate fi rulat (si proprietarul poate distruge
+    // executorul) inainte ca un notify facut dupa unlock sa se termine
+    void post(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(task));
+        ready.notify_one();
+    }
+
+    size_t threadCount() const { return workers.size(); }
+
+    static AsyncExecutor* current() { return currentSlot(); }
+};
+
+#endif // ASYNC_EXECUTOR_HPP
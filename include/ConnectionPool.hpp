@@ -0,0 +1,349 @@
+#ifndef CONNECTION_POOL_HPP
+#define CONNECTION_POOL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * ============================================================================
+ * ConnectionPool<Connection>: pool thread-safe de conexiuni cu lease-uri RAII
+ * ============================================================================
+ *
+ * - acquire() intoarce un Lease; la distrugerea lease-ului conexiunea revine
+ *   in pool (Item 13: resursa e eliberata de destructor, nu de apelant)
+ * - Conexiunile noi sunt create prin factory, fara mutex-ul pool-ului luat
+ *   (crearea poate dura milisecunde)
+ * - minSize conexiuni sunt create la constructie; cel mult maxSize exista
+ *   simultan (libere + imprumutate)
+ * - Conexiunile libere sunt refolosite LIFO (cea mai "calda" prima); cele
+ *   nefolosite de mai mult de idleTimeout sunt inchise (peste minSize) de
+ *   acquire(), la returnarea unei conexiuni si de evictIdle(). Nu exista un
+ *   thread de fundal: un pool in care nu se intampla nimic nu inchide nimic
+ *   pana cand aplicatia nu apeleaza evictIdle() (de ex. periodic)
+ * - Health check: o conexiune libera de mai mult de validateAfterIdle este
+ *   verificata inainte de a fi imprumutata; daca pica, e inchisa si inlocuita
+ *   cu una noua, care e imprumutata in locul ei. Lease::markBroken() scoate o
+ *   conexiune stricata din pool
+ * - Cand o conexiune e scoasa (markBroken, health check care arunca) si pool-ul
+ *   coboara sub minSize, thread-ul care a scos-o creeaza inlocuitorii. Daca
+ *   factory-ul esueaza atunci, pool-ul ramane sub minSize pana la urmatorul
+ *   evictIdle() sau pana cand acquire() creeaza conexiuni la cerere
+ * - Cand pool-ul e plin, acquire() asteapta cel mult timeout-ul dat si apoi
+ *   arunca std::runtime_error
+ *
+ * Pool-ul trebuie sa traiasca mai mult decat toate lease-urile lui.
+ */
+struct ConnectionPoolOptions {
+    size_t minSize = 1;
+    size_t maxSize = 8;
+    std::chrono::milliseconds idleTimeout{30000};
+    std::chrono::milliseconds validateAfterIdle{1000};
+    std::chrono::milliseconds acquireTimeout{1000};
+};
+
+struct ConnectionPoolStats {
+    uint64_t created = 0;
+    uint64_t destroyed = 0;
+    uint64_t acquired = 0;
+    uint64_t waited = 0;          // acquire-uri care au trebuit sa astepte
+    uint64_t timeouts = 0;
+    uint64_t evicted = 0;         // inchise pentru ca au stat prea mult libere
+    uint64_t failedHealthChecks = 0;
+    size_t idle = 0;
+    size_t inUse = 0;
+};
+
+template <typename Connection>
+class ConnectionPool {
+public:
+    using Factory = std::function<std::unique_ptr<Connection>()>;
+    using HealthCheck = std::function<bool(Connection&)>;
+    using Clock = std::chrono::steady_clock;
+
+    class Lease {
+    private:
+        ConnectionPool* pool = nullptr;
+        std::unique_ptr<Connection> connection;
+        bool broken = false;
+
+        friend class ConnectionPool;
+
+        Lease(ConnectionPool* p, std::unique_ptr<Connection> c) : pool(p), connection(std::move(c)) {}
+
+    public:
+        Lease() = default;
+
+        ~Lease() { release(); }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        Lease(Lease&& other) noexcept
+            : pool(other.pool), connection(std::move(other.connection)), broken(other.broken) {
+            other.pool = nullptr;
+        }
+
+        Lease& operator=(Lease&& other) noexcept {
+            if (this != &other) {
+                release();
+                pool = other.pool;
+                connection = std::move(other.connection);
+                broken = other.broken;
+                other.pool = nullptr;
+            }
+            return *this;
+        }
+
+        Connection* operator->() const { return connection.get(); }
+        Connection& operator*() const { return *connection; }
+        Connection* get() const { return connection.get(); }
+        explicit operator bool() const { return connection != nullptr; }
+
+        // Conexiunea nu mai e refolosita: la release() este inchisa
+        void markBroken() { broken = true; }
+
+        // Returneaza conexiunea in pool inainte de sfarsitul scope-ului
+        void release() {
+            if (pool && connection) {
+                pool->giveBack(std::move(connection), broken);
+            }
+            pool = nullptr;
+            connection.reset();
+        }
+    };
+
+private:
+    struct IdleConnection {
+        std::unique_ptr<Connection> connection;
+        Clock::time_point since;
+    };
+
+    Factory factory;
+    HealthCheck healthCheck;
+    ConnectionPoolOptions options;
+
+    mutable std::mutex mutex;
+    std::condition_variable available;
+    std::deque<IdleConnection> idle;   // back = cea mai recent returnata
+    size_t total = 0;                  // libere + imprumutate + in curs de creare
+    bool closed = false;
+    ConnectionPoolStats counters;
+
+    // Scoate din pool conexiunile libere expirate (cele mai vechi sunt in fata).
+    // Apelat cu mutex-ul luat; conexiunile sunt distruse de apelant, dupa unlock.
+    void collectExpired(Clock::time_point now, std::vector<std::unique_ptr<Connection>>& out) {
+        while (!idle.empty() && total > options.minSize && now - idle.front().since > options.idleTimeout) {
+            out.push_back(std::move(idle.front().connection));
+            idle.pop_front();
+            --total;
+            ++counters.evicted;
+            ++counters.destroyed;
+        }
+    }
+
+    void giveBack(std::unique_ptr<Connection> connection, bool broken) {
+        std::vector<std::unique_ptr<Connection>> toClose;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (broken || closed) {
+                toClose.push_back(std::move(connection));
+                --total;
+                ++counters.destroyed;
+            } else {
+                Clock::time_point now = Clock::now();
+                idle.push_back({std::move(connection), now});
+                collectExpired(now, toClose);
+            }
+        }
+        available.notify_one();
+        if (broken) {
+            replenish();
+        }
+    }
+
+    // Readuce pool-ul la minSize. Apelat fara mutex, inclusiv din ~Lease:
+    // nu arunca (o eroare a factory-ului opreste refacerea)
+    void replenish() noexcept {
+        try {
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (closed || total >= options.minSize) {
+                        return;
+                    }
+                    ++total;
+                }
+                std::unique_ptr<Connection> fresh = create();
+                std::unique_ptr<Connection> toClose;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++counters.created;
+                    if (closed) {
+                        toClose = std::move(fresh);
+                        --total;
+                        ++counters.destroyed;
+                    } else {
+                        idle.push_back({std::move(fresh), Clock::now()});
+                    }
+                }
+                available.notify_one();
+            }
+        } catch (...) {
+        }
+    }
+
+    std::unique_ptr<Connection> create() {
+        try {
+            return factory();
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --total;
+            }
+            available.notify_one();
+            throw;
+        }
+    }
+
+public:
+    ConnectionPool(Factory f, HealthCheck check = {}, ConnectionPoolOptions opts = {})
+        : factory(std::move(f)), healthCheck(std::move(check)), options(opts) {
+        if (options.maxSize == 0) {
+            throw std::invalid_argument("ConnectionPool: maxSize trebuie sa fie > 0");
+        }
+        if (options.minSize > options.maxSize) {
+            options.minSize = options.maxSize;
+        }
+        for (size_t i = 0; i < options.minSize; ++i) {
+            idle.push_back({factory(), Clock::now()});
+            ++total;
+            ++counters.created;
+        }
+    }
+
+    ~ConnectionPool() { close(); }
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    Lease acquire() { return acquire(options.acquireTimeout); }
+
+    Lease acquire(std::chrono::milliseconds timeout) {
+        const Clock::time_point deadline = Clock::now() + timeout;
+        bool counted = false;
+        std::vector<std::unique_ptr<Connection>> expired;   // distruse dupa unlock
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            if (closed) {
+                throw std::runtime_error("ConnectionPool inchis");
+            }
+            collectExpired(Clock::now(), expired);
+
+            if (!idle.empty()) {
+                IdleConnection candidate = std::move(idle.back());
+                idle.pop_back();
+                bool validate = healthCheck && Clock::now() - candidate.since > options.validateAfterIdle;
+                if (!validate) {
+                    ++counters.acquired;
+                    return Lease(this, std::move(candidate.connection));
+                }
+                lock.unlock();
+                bool healthy = false;
+                try {
+                    healthy = healthCheck(*candidate.connection);
+                } catch (...) {
+                    // Ca in create(): locul conexiunii se elibereaza, altfel
+                    // fiecare exceptie ar micsora pool-ul definitiv
+                    candidate.connection.reset();
+                    lock.lock();
+                    --total;
+                    ++counters.failedHealthChecks;
+                    ++counters.destroyed;
+                    lock.unlock();
+                    available.notify_one();
+                    replenish();
+                    throw;
+                }
+                if (!healthy) {
+                    // Locul ramane rezervat pentru inlocuitor, deci pool-ul nu
+                    // coboara sub minSize; create() il elibereaza daca esueaza
+                    candidate.connection.reset();
+                    lock.lock();
+                    ++counters.failedHealthChecks;
+                    ++counters.destroyed;
+                    lock.unlock();
+                    candidate.connection = create();
+                    lock.lock();
+                    ++counters.created;
+                }
+                ++counters.acquired;
+                return Lease(this, std::move(candidate.connection));
+            }
+
+            if (total < options.maxSize) {
+                ++total;
+                lock.unlock();
+                std::unique_ptr<Connection> fresh = create();
+                lock.lock();
+                ++counters.created;
+                ++counters.acquired;
+                return Lease(this, std::move(fresh));
+            }
+
+            if (!counted) {
+                ++counters.waited;
+                counted = true;
+            }
+            if (available.wait_until(lock, deadline) == std::cv_status::timeout &&
+                idle.empty() && total >= options.maxSize) {
+                ++counters.timeouts;
+                throw std::runtime_error("ConnectionPool: timeout la obtinerea unei conexiuni");
+            }
+        }
+    }
+
+    // Inchide conexiunile libere expirate si reface pool-ul pana la minSize;
+    // intoarce cate conexiuni au fost inchise
+    size_t evictIdle() {
+        std::vector<std::unique_ptr<Connection>> toClose;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            collectExpired(Clock::now(), toClose);
+        }
+        replenish();
+        return toClose.size();
+    }
+
+    // Inchide conexiunile libere; cele imprumutate sunt inchise la returnare
+    void close() {
+        std::deque<IdleConnection> toClose;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+            total -= idle.size();
+            counters.destroyed += idle.size();
+            toClose.swap(idle);
+        }
+        available.notify_all();
+    }
+
+    ConnectionPoolStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        ConnectionPoolStats result = counters;
+        result.idle = idle.size();
+        result.inUse = total - idle.size();
+        return result;
+    }
+
+    const ConnectionPoolOptions& getOptions() const { return options; }
+};
+
+#endif // CONNECTION_POOL_HPP
@@ -0,0 +1,175 @@
+#ifndef COW_BUFFER_HPP
+#define COW_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "IntrusivePtr.hpp"
+
+/**
+ * ============================================================================
+ * CowBuffer<T>: buffer partajat la copiere, duplicat la prima scriere
+ * ============================================================================
+ *
+ *     CowBuffer<int> a(1000000, 7);
+ *     CowBuffer<int> b = a;        // O(1): doar un increment atomic
+ *     int x = b[42];               // citire: bufferul ramane partajat
+ *     b.set(42, 1);                // prima scriere: b primeste copia proprie
+ *
+ * - Copierea si asignarea partajeaza blocul (IntrusivePtr, contor atomic);
+ *   fan-out-ul unui buffer mare catre multi consumatori costa O(1)
+ * - Accesul const (operator[], data(), begin/end) nu copiaza niciodata
+ * - Orice acces de scriere (set, mutableData, mutableAt, fill, rewrite) face
+ *   intai detach(): daca blocul e partajat, se copiaza o singura data
+ * - mutableData()/mutableAt() dau un pointer/referinta in bloc care poate fi
+ *   folosit(a) si dupa o copiere ulterioara. Ca la vechiul std::string COW,
+ *   blocul e marcat atunci "nepartajabil": copiile lui facute de acum inainte
+ *   sunt deep copy, deci scrierile prin pointer nu ajung in ele. Pentru
+ *   scrieri punctuale, set() nu are aceasta problema (si blocul ramane COW)
+ * - make_unique_copy(): copie proprie explicita (deep copy), ca inainte
+ *
+ * Copii diferite pot fi folosite din thread-uri diferite; acelasi obiect
+ * CowBuffer nu trebuie modificat concurent (ca std::shared_ptr).
+ * Pointerii obtinuti din data() pot deveni invalizi dupa o scriere.
+ */
+template <typename T>
+class CowBuffer {
+private:
+    struct Block : RefCounted<Block> {
+        size_t size;
+        std::unique_ptr<T[]> items;
+        bool unshareable = false;   // s-a dat un T* / T& mutabil in bloc
+
+        // Elementele sunt default-initializate (int: neinitializat); apelantul le scrie
+        explicit Block(size_t n) : size(n), items(n ? new T[n] : nullptr) {}
+    };
+
+    IntrusivePtr<Block> block;
+
+    static IntrusivePtr<Block> makeBlock(size_t n) { return makeIntrusive<Block>(n); }
+
+    IntrusivePtr<Block> copyBlock() const {
+        IntrusivePtr<Block> copy = makeBlock(block->size);
+        std::copy(begin(), end(), copy->items.get());
+        return copy;
+    }
+
+    // Ce primeste o copie: blocul partajat sau, daca e nepartajabil, unul nou
+    IntrusivePtr<Block> blockForCopy() const {
+        return block && block->unshareable ? copyBlock() : block;
+    }
+
+public:
+    using value_type = T;
+
+    CowBuffer() = default;
+
+    explicit CowBuffer(size_t n, const T& value = T()) : block(makeBlock(n)) {
+        std::fill_n(block->items.get(), n, value);
+    }
+
+    CowBuffer(std::initializer_list<T> values) : block(makeBlock(values.size())) {
+        std::copy(values.begin(), values.end(), block->items.get());
+    }
+
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    CowBuffer(It first, It last) : block(makeBlock(static_cast<size_t>(std::distance(first, last)))) {
+        std::copy(first, last, block->items.get());
+    }
+
+    // Copiere/asignare: O(1), partajeaza blocul (deep copy daca blocul e
+    // nepartajabil). Mutare: preia handle-ul.
+    CowBuffer(const CowBuffer& other) : block(other.blockForCopy()) {}
+    CowBuffer& operator=(const CowBuffer& rhs) {
+        block = rhs.blockForCopy();
+        return *this;
+    }
+    CowBuffer(CowBuffer&&) noexcept = default;
+    CowBuffer& operator=(CowBuffer&&) noexcept = default;
+
+    size_t size() const { return block ? block->size : 0; }
+    bool empty() const { return size() == 0; }
+
+    // --- Citire (nu copiaza niciodata) ---
+    const T* data() const { return block ? block->items.get() : nullptr; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size(); }
+
+    const T& operator[](size_t index) const {
+        if (index >= size()) throw std::out_of_range("Index out of bounds");
+        return block->items[index];
+    }
+
+    // Cate handle-uri partajeaza blocul (informativ)
+    size_t useCount() const { return block.useCount(); }
+    bool isShared() const { return block && !block.unique(); }
+
+    // --- Control explicit ---
+
+    // Dupa detach() acest obiect e singurul proprietar al blocului
+    void detach() {
+        if (isShared()) {
+            *this = make_unique_copy();
+        }
+    }
+
+    // Copie proprie, nepartajata cu nimeni (deep copy explicit)
+    CowBuffer make_unique_copy() const {
+        CowBuffer copy;
+        if (block) {
+            copy.block = copyBlock();
+        }
+        return copy;
+    }
+
+    // --- Scriere (detach implicit) ---
+    void set(size_t index, const T& value) {
+        if (index >= size()) throw std::out_of_range("Index out of bounds");
+        detach();
+        block->items[index] = value;
+    }
+
+    // Blocul devine nepartajabil (vezi mai sus)
+    T* mutableData() {
+        detach();
+        if (!block) {
+            return nullptr;
+        }
+        block->unshareable = true;
+        return block->items.get();
+    }
+
+    T& mutableAt(size_t index) {
+        if (index >= size()) throw std::out_of_range("Index out of bounds");
+        return mutableData()[index];
+    }
+
+    // Rescrie tot continutul: f(dst, src, n). Daca blocul e partajat,
+    // rezultatul e scris direct intr-un bloc nou (o singura trecere, fara
+    // copia intermediara a lui detach); altfel dst == src (in-place).
+    template <typename F>
+    void rewrite(F f) {
+        if (!block) {
+            return;
+        }
+        if (!isShared()) {
+            f(block->items.get(), static_cast<const T*>(block->items.get()), block->size);
+            return;
+        }
+        // Sursa ramane in viata prin `block` pana la asignarea de la final
+        IntrusivePtr<Block> fresh = makeBlock(block->size);
+        f(fresh->items.get(), static_cast<const T*>(block->items.get()), block->size);
+        block = std::move(fresh);
+    }
+
+    void fill(const T& value) {
+        rewrite([&value](T* dst, const T*, size_t n) { std::fill_n(dst, n, value); });
+    }
+};
+
+#endif // COW_BUFFER_HPP
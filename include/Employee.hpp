@@ -1,48 +1,99 @@
-#ifndef EMPLOYEE_HPP
-#define EMPLOYEE_HPP
-
-#include "Person.hpp"
-#include <string>
-
-/**
- * Clasa Employee mosteneste Person si demonstreaza:
- * Item 12: Copy all parts of an object (inclusiv in clase derivate)
- */
-class Employee : public Person {
-private:
-    std::string employeeId;
-    double salary;
-    std::string* department;  // pointer pentru deep copy
-
-public:
-    // Constructor
-    Employee(const std::string& name = "", int age = 0, 
-             const std::string& addr = "", const std::string& empId = "",
-             double sal = 0.0, const std::string& dept = "");
-    
-    // Copy constructor - Item 12: trebuie sa copieze si partea din clasa de baza
-    Employee(const Employee& other);
-    
-    // Assignment operator - Item 10, 11, 12
-    Employee& operator=(const Employee& rhs);
-    
-    // Destructor
-    ~Employee();
-    
-    // Getters
-    std::string getEmployeeId() const;
-    double getSalary() const;
-    std::string getDepartment() const;
-    
-    // Setters
-    void setEmployeeId(const std::string& empId);
-    void setSalary(double sal);
-    void setDepartment(const std::string& dept);
-    
-    // Display
-    void display() const;
-};
-
-#endif // EMPLOYEE_HPP
-
-
+#ifndef EMPLOYEE_HPP
+#define EMPLOYEE_HPP
+
+#include "Person.hpp"
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * Clasa Employee mosteneste Person si demonstreaza:
+ * Item 12: Copy all parts of an object (inclusiv in clase derivate)
+ */
+class Employee : public Person {
+private:
+    std::string employeeId;
+    double salary;
+    std::string department;  // inline, fara alocare separata
+
+public:
+    // Constructor
+    Employee(const std::string& name = "", int age = 0, 
+             const std::string& addr = "", const std::string& empId = "",
+             double sal = 0.0, const std::string& dept = "");
+    
+    // Copy constructor - Item 12: trebuie sa copieze si partea din clasa de baza
+    Employee(const Employee& other);
+    
+    // Move constructor - muta si partea din clasa de baza
+    Employee(Employee&& other) noexcept;
+    
+    // Assignment operator - Item 10, 11, 12
+    Employee& operator=(const Employee& rhs);
+    
+    // Move assignment
+    Employee& operator=(Employee&& rhs) noexcept;
+    
+    // Schimba continutul (inclusiv partea Person)
+    void swap(Employee& other) noexcept;
+    
+    // Destructor
+    ~Employee();
+    
+    // Alocare din SlabPool<Employee> (cache per thread, fara lock pe calea rapida)
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p, std::size_t size) noexcept;
+    
+    // Getters
+    std::string getEmployeeId() const;
+    double getSalary() const;
+    std::string getDepartment() const;
+    
+    // Getters fara alocari (vezi Person::getNameView)
+    std::string_view getEmployeeIdView() const noexcept;
+    std::string_view getDepartmentView() const noexcept;
+    
+    // Setters
+    void setEmployeeId(const std::string& empId);
+    void setSalary(double sal);
+    void setDepartment(const std::string& dept);
+    
+    // Display
+    void display() const;
+};
+
+inline void swap(Employee& a, Employee& b) noexcept {
+    a.swap(b);
+}
+
+inline std::string_view Employee::getEmployeeIdView() const noexcept {
+    return employeeId;
+}
+
+inline std::string_view Employee::getDepartmentView() const noexcept {
+    return department;
+}
+
+// Citire in bloc in buffer-ul apelantului (vezi readNames)
+inline void readEmployeeIds(const Employee* employees, size_t count, std::string_view* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = employees[i].getEmployeeIdView();
+    }
+}
+
+inline void readDepartments(const Employee* employees, size_t count, std::string_view* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = employees[i].getDepartmentView();
+    }
+}
+
+// Salariile in buffer-ul apelantului
+inline void readSalaries(const Employee* employees, size_t count, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = employees[i].getSalary();
+    }
+}
+
+#endif // EMPLOYEE_HPP
+
+
@@ -0,0 +1,87 @@
+#ifndef EMPLOYEE_STORE_HPP
+#define EMPLOYEE_STORE_HPP
+
+#include "Employee.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * EmployeeStore: stocare pe coloane (struct-of-arrays) pentru analize bulk
+ *
+ * In loc de un vector de obiecte Employee (stringuri imprastiate pe heap),
+ * fiecare camp are propria coloana contigua:
+ * - salaries, ages, departmentIds: vectori de tipuri primitive
+ * - employee id: toate caracterele intr-un singur buffer + offset-uri
+ * - department: internat (fiecare nume unic primeste un id uint32_t)
+ *
+ * Kernel-urile (sume, filtre, group-by) parcurg coloanele secvential, cu
+ * mai multi acumulatori independenti, ca sa poata fi vectorizate.
+ */
+class EmployeeStore {
+private:
+    std::vector<double> salaries;
+    std::vector<int32_t> ages;
+    std::vector<uint32_t> departmentIds;
+    std::vector<char> idChars;        // toate employee id-urile concatenate
+    std::vector<uint32_t> idOffsets;  // idOffsets[i]..idOffsets[i+1] = id-ul i
+
+    std::vector<std::string> departmentNames;
+    std::unordered_map<std::string, uint32_t> departmentIndex;
+
+public:
+    static constexpr uint32_t kNoDepartment = UINT32_MAX;
+
+    EmployeeStore();
+
+    void reserve(size_t count, size_t averageIdLength = 8);
+
+    // Intoarce id-ul numeric al departamentului (il creeaza daca lipseste)
+    uint32_t internDepartment(std::string_view name);
+
+    // kNoDepartment daca departamentul nu exista
+    uint32_t findDepartment(std::string_view name) const;
+
+    void add(std::string_view employeeId, int age, double salary, std::string_view department);
+    void add(const Employee& employee);
+    // Departament deja internat (loader-ele bulk evita cautarea per rand).
+    // std::out_of_range daca id-ul nu exista; std::length_error daca id-urile
+    // concatenate ar depasi 4 GiB (offset-uri pe 32 de biti)
+    void add(std::string_view employeeId, int age, double salary, uint32_t departmentId);
+
+    // Acces pe rand (fara alocari)
+    size_t size() const { return salaries.size(); }
+    double salary(size_t i) const { return salaries[i]; }
+    int age(size_t i) const { return ages[i]; }
+    uint32_t departmentId(size_t i) const { return departmentIds[i]; }
+    std::string_view department(size_t i) const { return departmentNames[departmentIds[i]]; }
+    std::string_view employeeId(size_t i) const {
+        return std::string_view(idChars.data() + idOffsets[i], idOffsets[i + 1] - idOffsets[i]);
+    }
+
+    size_t departmentCount() const { return departmentNames.size(); }
+    const std::string& departmentName(uint32_t id) const { return departmentNames[id]; }
+
+    // Coloane brute, pentru kernel-uri scrise de apelant
+    const double* salaryColumn() const { return salaries.data(); }
+    const int32_t* ageColumn() const { return ages.data(); }
+    const uint32_t* departmentColumn() const { return departmentIds.data(); }
+
+    // --- Kernel-uri de agregare ---
+    double totalSalary() const;
+    double totalSalary(uint32_t departmentId) const;
+    double averageSalary() const;
+
+    // Indicii angajatilor cu minAge <= age <= maxAge
+    std::vector<uint32_t> filterByAge(int minAge, int maxAge) const;
+    size_t countByAge(int minAge, int maxAge) const;
+
+    // Suma salariilor / numarul de angajati pentru fiecare departament (index = id)
+    std::vector<double> salaryByDepartment() const;
+    std::vector<size_t> headcountByDepartment() const;
+};
+
+#endif // EMPLOYEE_STORE_HPP
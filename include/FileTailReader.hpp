@@ -0,0 +1,113 @@
+#ifndef FILE_TAIL_READER_HPP
+#define FILE_TAIL_READER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+/**
+ * ============================================================================
+ * FileTailReader: citire incrementala a unui fisier in care se scrie (tail -f)
+ * ============================================================================
+ *
+ * - Fisierul ramane deschis; reader-ul tine minte offset-ul pana la care a citit
+ * - readNew() citeste DOAR octetii adaugati de la ultimul apel, deci costul unei
+ *   treziri depinde de cantitatea de date noi, nu de dimensiunea fisierului
+ * - Writer-ul apeleaza notifyAppended() dupa flush; reader-ul asteapta in
+ *   waitForData() pe un condition variable in loc sa doarma un timp fix
+ * - Daca fisierul a fost trunchiat (ex: rotatie de log), citirea reincepe de la 0
+ */
+class FileTailReader {
+private:
+    std::ifstream file;
+    std::string filename;
+    uint64_t offset;
+
+    std::mutex notifyMutex;
+    std::condition_variable notifyCv;
+    uint64_t notifiedVersion = 0;
+    uint64_t seenVersion = 0;
+    bool closed = false;
+
+public:
+    explicit FileTailReader(const std::string& fname, uint64_t startOffset = 0)
+        : file(fname, std::ios::in | std::ios::binary), filename(fname), offset(startOffset) {}
+
+    FileTailReader(const FileTailReader&) = delete;
+    FileTailReader& operator=(const FileTailReader&) = delete;
+
+    // Adauga la 'out' octetii scrisi de la ultimul apel; intoarce cati au fost cititi
+    size_t readNew(std::string& out) {
+        if (!file.is_open()) {
+            file.open(filename, std::ios::in | std::ios::binary);
+            if (!file.is_open()) {
+                return 0;
+            }
+        }
+
+        file.clear();  // EOF de la citirea anterioara
+        file.seekg(0, std::ios::end);
+        uint64_t size = static_cast<uint64_t>(file.tellg());
+        if (size < offset) {
+            offset = 0;  // fisier trunchiat
+        }
+        if (size == offset) {
+            return 0;
+        }
+
+        size_t count = static_cast<size_t>(size - offset);
+        size_t oldLength = out.size();
+        out.resize(oldLength + count);
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(&out[oldLength], static_cast<std::streamsize>(count));
+
+        size_t got = static_cast<size_t>(file.gcount());
+        out.resize(oldLength + got);
+        offset += got;
+        return got;
+    }
+
+    // Apelat de writer dupa ce a facut flush la date noi
+    void notifyAppended() {
+        {
+            std::lock_guard<std::mutex> lock(notifyMutex);
+            ++notifiedVersion;
+        }
+        notifyCv.notify_one();
+    }
+
+    // Writer-ul a terminat; waitForData() nu mai blocheaza
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(notifyMutex);
+            closed = true;
+        }
+        notifyCv.notify_all();
+    }
+
+    // Blocheaza pana la o notificare noua. false = inchis si nimic nou
+    bool waitForData() {
+        std::unique_lock<std::mutex> lock(notifyMutex);
+        notifyCv.wait(lock, [this] { return notifiedVersion != seenVersion || closed; });
+        bool hasNew = notifiedVersion != seenVersion;
+        seenVersion = notifiedVersion;
+        return hasNew;
+    }
+
+    // La fel, dar cu timeout (util cand writer-ul e in alt proces si nu notifica).
+    // false = timeout sau inchis; readNew() poate gasi totusi date noi
+    bool waitForData(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(notifyMutex);
+        notifyCv.wait_for(lock, timeout, [this] { return notifiedVersion != seenVersion || closed; });
+        bool hasNew = notifiedVersion != seenVersion;
+        seenVersion = notifiedVersion;
+        return hasNew;
+    }
+
+    uint64_t position() const { return offset; }
+};
+
+#endif // FILE_TAIL_READER_HPP
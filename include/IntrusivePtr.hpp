@@ -0,0 +1,217 @@
+#ifndef INTRUSIVE_PTR_HPP
+#define INTRUSIVE_PTR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * ============================================================================
+ * IntrusivePtr<T>: pointer cu numarare de referinte in interiorul obiectului
+ * ============================================================================
+ *
+ *     struct Node : RefCounted<Node> { int value = 0; };
+ *     IntrusivePtr<Node> a = makeIntrusive<Node>();
+ *     IntrusivePtr<Node> b = a;   // un singur increment, fara control block
+ *
+ * - Contorul sta in obiect (baza RefCounted), nu intr-un control block
+ *   separat ca la std::shared_ptr: o singura alocare, contorul e in aceeasi
+ *   linie de cache cu datele, iar IntrusivePtr are dimensiunea unui pointer
+ * - AtomicRefCount: increment relaxed (cine copiaza detine deja o referinta),
+ *   decrement acq_rel (ultimul proprietar vede toate scrierile celorlalti
+ *   inainte de delete) - handle-urile pot fi copiate liber intre thread-uri
+ * - LocalRefCount: contor simplu, pentru obiecte care nu parasesc un thread
+ * - Politica implicita se alege la compilare: cu
+ *   EFFECTIVECPP_SINGLE_THREADED_REFCOUNT definit devine LocalRefCount;
+ *   un tip anume o poate alege explicit: RefCounted<Node, LocalRefCount>
+ *
+ * Fara weak pointers: obiectul e distrus imediat ce contorul ajunge la 0.
+ *
+ * release() face delete prin Derived-ul din RefCounted<Derived>. Un tip
+ * derivat mai departe (struct Sub : Node) poate fi folosit in IntrusivePtr /
+ * makeIntrusive doar daca Node are destructor virtual (static_assert).
+ */
+
+struct AtomicRefCount {
+    std::atomic<uint32_t> value{0};
+
+    void increment() noexcept { value.fetch_add(1, std::memory_order_relaxed); }
+
+    // true daca aceasta a fost ultima referinta
+    bool decrement() noexcept { return value.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+    uint32_t load() const noexcept { return value.load(std::memory_order_relaxed); }
+
+    // acquire: daca suntem singurul proprietar, vedem tot ce au facut cei
+    // care au renuntat la referinte inainte (ex: inainte de o scriere in-place)
+    bool unique() const noexcept { return value.load(std::memory_order_acquire) == 1; }
+
+    // Doar pentru un obiect inca nepartajat: store simplu, fara RMW atomic
+    void init(uint32_t v) noexcept { value.store(v, std::memory_order_relaxed); }
+};
+
+struct LocalRefCount {
+    uint32_t value = 0;
+
+    void increment() noexcept { ++value; }
+    bool decrement() noexcept { return --value == 0; }
+    uint32_t load() const noexcept { return value; }
+    bool unique() const noexcept { return value == 1; }
+    void init(uint32_t v) noexcept { value = v; }
+};
+
+#ifdef EFFECTIVECPP_SINGLE_THREADED_REFCOUNT
+using DefaultRefCount = LocalRefCount;
+#else
+using DefaultRefCount = AtomicRefCount;
+#endif
+
+// Baza CRTP: Derived este distrus (cu delete) cand ultima referinta dispare
+template <typename Derived, typename Count = DefaultRefCount>
+class RefCounted {
+private:
+    mutable Count refs;
+
+protected:
+    RefCounted() = default;
+    ~RefCounted() = default;
+
+public:
+    using RefCountedType = Derived;
+
+    // Copierea obiectului nu copiaza contorul: copia are proprii proprietari
+    RefCounted(const RefCounted&) noexcept {}
+    RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+
+    void addRef() const noexcept { refs.increment(); }
+
+    void release() const noexcept {
+        if (refs.decrement()) {
+            delete static_cast<const Derived*>(this);
+        }
+    }
+
+    uint32_t refCount() const noexcept { return refs.load(); }
+    bool hasSingleRef() const noexcept { return refs.unique(); }
+
+    // Prima referinta a unui obiect abia creat (folosit de makeIntrusive)
+    void adoptFirstRef() const noexcept { refs.init(1); }
+};
+
+// T poate fi distrus de release(): e chiar Derived-ul bazei CRTP, sau
+// Derived are destructor virtual (delete prin Derived* distruge tot T)
+template <typename T>
+inline constexpr bool kIntrusiveDeletable =
+    std::is_same_v<std::remove_cv_t<T>, typename T::RefCountedType> ||
+    std::has_virtual_destructor_v<typename T::RefCountedType>;
+
+// IntrusivePtr(p, adoptRef): preia o referinta deja numarata, fara increment
+struct AdoptRef {};
+inline constexpr AdoptRef adoptRef{};
+
+template <typename T>
+class IntrusivePtr {
+private:
+    T* ptr = nullptr;
+
+    // release() face delete prin tipul din RefCounted<Derived>: conversia
+    // Sub -> Base e permisa doar daca Base are destructor virtual (altfel
+    // ultima referinta ar distruge obiectul ca Base - comportament nedefinit).
+    // Adaugarea lui const e mereu sigura (acelasi tip dinamic)
+    template <typename U>
+    static constexpr bool kSafeConversion =
+        std::is_convertible_v<U*, T*> &&
+        (std::is_same_v<std::remove_cv_t<U>, std::remove_cv_t<T>> || std::has_virtual_destructor_v<T>);
+
+    template <typename U>
+    friend class IntrusivePtr;
+
+public:
+    using element_type = T;
+
+    IntrusivePtr() noexcept = default;
+    IntrusivePtr(std::nullptr_t) noexcept {}
+
+    // Preia o referinta noua la p (contorul creste)
+    explicit IntrusivePtr(T* p) noexcept : ptr(p) {
+        if (ptr) {
+            ptr->addRef();
+        }
+    }
+
+    IntrusivePtr(T* p, AdoptRef) noexcept : ptr(p) {}
+
+    IntrusivePtr(const IntrusivePtr& other) noexcept : ptr(other.ptr) {
+        if (ptr) {
+            ptr->addRef();
+        }
+    }
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept : ptr(std::exchange(other.ptr, nullptr)) {}
+
+    template <typename U, typename = std::enable_if_t<kSafeConversion<U>>>
+    IntrusivePtr(const IntrusivePtr<U>& other) noexcept : ptr(other.ptr) {
+        if (ptr) {
+            ptr->addRef();
+        }
+    }
+
+    template <typename U, typename = std::enable_if_t<kSafeConversion<U>>>
+    IntrusivePtr(IntrusivePtr<U>&& other) noexcept : ptr(std::exchange(other.ptr, nullptr)) {}
+
+    // Verificarea sta aici, nu in corpul clasei: T poate fi incomplet acolo
+    // unde e doar declarat un IntrusivePtr<T> (ex. membru in propriul tip)
+    ~IntrusivePtr() {
+        static_assert(kIntrusiveDeletable<T>,
+                      "IntrusivePtr<T>: T deriva dintr-un tip RefCounted fara destructor virtual");
+        if (ptr) {
+            ptr->release();
+        }
+    }
+
+    // Copy-and-swap: corect si cand rhs e tinut in viata doar de *this.
+    // Acelasi obiect: nicio operatie atomica (ca shared_ptr)
+    IntrusivePtr& operator=(const IntrusivePtr& rhs) noexcept {
+        if (ptr != rhs.ptr) {
+            IntrusivePtr(rhs).swap(*this);
+        }
+        return *this;
+    }
+
+    IntrusivePtr& operator=(IntrusivePtr&& rhs) noexcept {
+        IntrusivePtr(std::move(rhs)).swap(*this);
+        return *this;
+    }
+
+    void reset() noexcept { IntrusivePtr().swap(*this); }
+    void reset(T* p) noexcept { IntrusivePtr(p).swap(*this); }
+
+    void swap(IntrusivePtr& other) noexcept { std::swap(ptr, other.ptr); }
+
+    T* get() const noexcept { return ptr; }
+    T& operator*() const noexcept { return *ptr; }
+    T* operator->() const noexcept { return ptr; }
+    explicit operator bool() const noexcept { return ptr != nullptr; }
+
+    // Ca shared_ptr::use_count: doar informativ cand handle-ul e partajat intre thread-uri
+    uint32_t useCount() const noexcept { return ptr ? ptr->refCount() : 0; }
+
+    // Singurul handle catre obiect: sigur de modificat in-place (copy-on-write)
+    bool unique() const noexcept { return ptr && ptr->hasSingleRef(); }
+
+    friend bool operator==(const IntrusivePtr& a, const IntrusivePtr& b) noexcept { return a.ptr == b.ptr; }
+    friend bool operator!=(const IntrusivePtr& a, const IntrusivePtr& b) noexcept { return a.ptr != b.ptr; }
+};
+
+template <typename T, typename... Args>
+IntrusivePtr<T> makeIntrusive(Args&&... args) {
+    static_assert(kIntrusiveDeletable<T>,
+                  "makeIntrusive<T>: T deriva dintr-un tip RefCounted fara destructor virtual");
+    T* p = new T(std::forward<Args>(args)...);
+    p->adoptFirstRef();
+    return IntrusivePtr<T>(p, adoptRef);
+}
+
+#endif // INTRUSIVE_PTR_HPP
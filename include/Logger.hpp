@@ -0,0 +1,105 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * ============================================================================
+ * Logger: logging de diagnostic cu niveluri, eliminabil la compilare
+ * ============================================================================
+ *
+ * - Nivelul minim compilat vine din EFFECTIVECPP_LOG_LEVEL (vezi CMakeLists.txt):
+ *   0=Trace 1=Debug 2=Info 3=Warn 4=Error 5=Off. Sub acest nivel, macro-urile
+ *   LOG_* devin ramuri "if constexpr (false)" - argumentele nici nu se evalueaza,
+ *   iar codul generat dispare complet
+ * - Peste nivelul compilat exista si un filtru la runtime: logging::setLevel()
+ * - Fiecare mesaj este formatat intr-un buffer local si scris dintr-o singura
+ *   bucata, terminat cu '\n' (fara std::endl) - nu fortam flush la fiecare linie
+ *
+ * Utilizare:
+ *     LOG_TRACE("[MemoryBlock] Alocare " << sz << " integers");
+ */
+
+#ifndef EFFECTIVECPP_LOG_LEVEL
+#define EFFECTIVECPP_LOG_LEVEL 0
+#endif
+
+namespace logging {
+
+enum class Level : int {
+    Trace = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4,
+    Off = 5
+};
+
+constexpr Level kCompiledLevel = static_cast<Level>(EFFECTIVECPP_LOG_LEVEL);
+
+// Nivelul este compilat in binar?
+constexpr bool isCompiled(Level level) {
+    return level != Level::Off && static_cast<int>(level) >= static_cast<int>(kCompiledLevel);
+}
+
+inline std::atomic<int> runtimeLevel(static_cast<int>(kCompiledLevel));
+
+inline void setLevel(Level level) {
+    runtimeLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+inline bool isEnabled(Level level) {
+    return isCompiled(level)
+           && static_cast<int>(level) >= runtimeLevel.load(std::memory_order_relaxed);
+}
+
+// Flush explicit (ex: inainte de a citi input de la utilizator)
+inline void flush() {
+    std::cout.flush();
+}
+
+// O linie de log: formatata local, scrisa atomic in destructor
+class LogLine {
+private:
+    std::ostringstream buffer;
+
+public:
+    LogLine() = default;
+
+    LogLine(const LogLine&) = delete;
+    LogLine& operator=(const LogLine&) = delete;
+
+    ~LogLine() {
+        buffer << '\n';
+        const std::string text = buffer.str();
+        std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    template <typename T>
+    LogLine& operator<<(const T& value) {
+        buffer << value;
+        return *this;
+    }
+};
+
+} // namespace logging
+
+#define EFFECTIVECPP_LOG(level, expr)                          \
+    do {                                                       \
+        if constexpr (::logging::isCompiled(level)) {          \
+            if (::logging::isEnabled(level)) {                 \
+                ::logging::LogLine() << expr;                  \
+            }                                                  \
+        }                                                      \
+    } while (0)
+
+#define LOG_TRACE(expr) EFFECTIVECPP_LOG(::logging::Level::Trace, expr)
+#define LOG_DEBUG(expr) EFFECTIVECPP_LOG(::logging::Level::Debug, expr)
+#define LOG_INFO(expr)  EFFECTIVECPP_LOG(::logging::Level::Info, expr)
+#define LOG_WARN(expr)  EFFECTIVECPP_LOG(::logging::Level::Warn, expr)
+#define LOG_ERROR(expr) EFFECTIVECPP_LOG(::logging::Level::Error, expr)
+
+#endif // LOGGER_HPP
@@ -0,0 +1,231 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * ============================================================================
+ * MappedFile: RAII pentru o mapare read-only a unui fisier in memorie
+ * ============================================================================
+ *
+ * - view() intoarce un std::string_view direct peste paginile din page cache:
+ *   zero copieri, zero alocari
+ * - Vederea (si orice string_view derivat din ea) este valida doar cat timp
+ *   obiectul MappedFile traieste
+ * - Un fisier gol este "mapat" cu o vedere goala
+ * - Daca maparea esueaza, isMapped() intoarce false (ca FileHandle::good())
+ */
+class MappedFile {
+private:
+    const char* data = nullptr;
+    size_t length = 0;
+    bool mapped = false;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+
+    void release() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mappingHandle) CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        fileHandle = INVALID_HANDLE_VALUE;
+        mappingHandle = nullptr;
+#else
+        if (data && length > 0) {
+            munmap(const_cast<char*>(data), length);
+        }
+#endif
+        data = nullptr;
+        length = 0;
+        mapped = false;
+    }
+
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                 nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize)) {
+            release();
+            return;
+        }
+        length = static_cast<size_t>(fileSize.QuadPart);
+        if (length > 0) {
+            mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mappingHandle) {
+                release();
+                return;
+            }
+            data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            if (!data) {
+                release();
+                return;
+            }
+        }
+        mapped = true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return;
+        }
+        length = static_cast<size_t>(st.st_size);
+        if (length > 0) {
+            void* addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                length = 0;
+                return;
+            }
+            data = static_cast<const char*>(addr);
+            // Citim secvential: kernel-ul poate face read-ahead agresiv
+            madvise(addr, length, MADV_SEQUENTIAL);
+        }
+        ::close(fd);  // maparea ramane valida si dupa inchiderea descriptorului
+        mapped = true;
+#endif
+    }
+
+    ~MappedFile() { release(); }
+
+    // Disable copying (maparea are un singur proprietar)
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data(other.data), length(other.length), mapped(other.mapped)
+#ifdef _WIN32
+        , fileHandle(other.fileHandle), mappingHandle(other.mappingHandle)
+#endif
+    {
+        other.data = nullptr;
+        other.length = 0;
+        other.mapped = false;
+#ifdef _WIN32
+        other.fileHandle = INVALID_HANDLE_VALUE;
+        other.mappingHandle = nullptr;
+#endif
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            data = other.data;
+            length = other.length;
+            mapped = other.mapped;
+            other.data = nullptr;
+            other.length = 0;
+            other.mapped = false;
+#ifdef _WIN32
+            fileHandle = other.fileHandle;
+            mappingHandle = other.mappingHandle;
+            other.fileHandle = INVALID_HANDLE_VALUE;
+            other.mappingHandle = nullptr;
+#endif
+        }
+        return *this;
+    }
+
+    std::string_view view() const { return std::string_view(data ? data : "", length); }
+    size_t size() const { return length; }
+    bool isMapped() const { return mapped; }
+};
+
+// ============================================================================
+// Iterare pe linii fara alocari: fiecare linie este un string_view (fara '\n')
+// ============================================================================
+class LineIterator {
+private:
+    std::string_view rest;      // textul ramas dupa linia curenta
+    std::string_view current;   // linia curenta
+    bool atEnd;
+
+    void advance() {
+        if (rest.empty()) {
+            atEnd = true;
+            current = std::string_view();
+            return;
+        }
+        size_t pos = rest.find('\n');
+        if (pos == std::string_view::npos) {
+            current = rest;
+            rest = std::string_view();
+        } else {
+            current = rest.substr(0, pos);
+            rest.remove_prefix(pos + 1);
+        }
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view*;
+    using reference = const std::string_view&;
+
+    LineIterator() : atEnd(true) {}
+    explicit LineIterator(std::string_view text) : rest(text), atEnd(false) { advance(); }
+
+    reference operator*() const { return current; }
+    pointer operator->() const { return &current; }
+
+    LineIterator& operator++() {
+        advance();
+        return *this;
+    }
+
+    LineIterator operator++(int) {
+        LineIterator tmp = *this;
+        advance();
+        return tmp;
+    }
+
+    bool operator==(const LineIterator& other) const {
+        if (atEnd || other.atEnd) return atEnd == other.atEnd;
+        return current.data() == other.current.data();
+    }
+    bool operator!=(const LineIterator& other) const { return !(*this == other); }
+};
+
+class LineRange {
+private:
+    std::string_view text;
+
+public:
+    explicit LineRange(std::string_view t) : text(t) {}
+
+    LineIterator begin() const { return LineIterator(text); }
+    LineIterator end() const { return LineIterator(); }
+};
+
+#endif // MAPPED_FILE_HPP
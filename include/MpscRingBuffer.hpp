@@ -0,0 +1,169 @@
+#ifndef MPSC_RING_BUFFER_HPP
+#define MPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/**
+ * ============================================================================
+ * MpscRingBuffer: canal in memorie, lock-free, mai multi producatori / un consumator
+ * ============================================================================
+ *
+ * - Capacitate fixa (rotunjita la putere a lui 2), fara alocari dupa constructie
+ * - Fiecare celula are un numar de secventa (algoritmul lui D. Vyukov):
+ *   producatorii rezerva o pozitie cu CAS pe tail, consumatorul citeste in ordine
+ * - Celulele si indicii sunt aliniate la cache line pentru a evita false sharing
+ * - tryPop() nu blocheaza; pop() face spin scurt, apoi doarme pe un condition
+ *   variable pe care producatorii il semnaleaza doar daca consumatorul doarme
+ * - close() trezeste consumatorul; pop() intoarce false cand canalul e inchis si gol
+ */
+template <typename T>
+class MpscRingBuffer {
+private:
+    static constexpr size_t kCacheLine = 64;
+    static constexpr int kSpinBeforeSleep = 256;
+
+    struct alignas(kCacheLine) Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+
+    alignas(kCacheLine) std::atomic<size_t> tail;   // scris de producatori
+    alignas(kCacheLine) size_t head;                // doar consumatorul il modifica
+
+    alignas(kCacheLine) std::atomic<bool> consumerSleeping;
+    std::atomic<bool> closed;
+    std::mutex waitMutex;
+    std::condition_variable waitCv;
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    bool headReady() const {
+        return cells[head & mask].sequence.load(std::memory_order_acquire) == head + 1;
+    }
+
+    void wakeConsumer() {
+        // Pereche cu fence-ul din pop(): fie producatorul vede consumerSleeping,
+        // fie consumatorul vede celula publicata - nu se pierde nicio trezire
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumerSleeping.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            waitCv.notify_one();
+        }
+    }
+
+public:
+    explicit MpscRingBuffer(size_t capacity)
+        : cells(new Cell[roundUpPow2(capacity)]), mask(roundUpPow2(capacity) - 1),
+          tail(0), head(0), consumerSleeping(false), closed(false) {
+        for (size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+    // Non-blocant: false daca buffer-ul e plin sau inchis
+    template <typename U>
+    bool tryPush(U&& value) {
+        if (closed.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        size_t pos = tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // plin
+            } else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        wakeConsumer();
+        return true;
+    }
+
+    // Blocant: asteapta (yield) cat timp buffer-ul e plin; false daca e inchis
+    template <typename U>
+    bool push(U&& value) {
+        while (!tryPush(std::forward<U>(value))) {
+            if (closed.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // Non-blocant - doar thread-ul consumator
+    bool tryPop(T& out) {
+        Cell& cell = cells[head & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != head + 1) {
+            return false;
+        }
+        out = std::move(cell.value);
+        cell.sequence.store(head + mask + 1, std::memory_order_release);
+        ++head;
+        return true;
+    }
+
+    // Blocant - doar thread-ul consumator. false = inchis si gol
+    bool pop(T& out) {
+        for (int i = 0; i < kSpinBeforeSleep; ++i) {
+            if (tryPop(out)) {
+                return true;
+            }
+        }
+        while (true) {
+            if (tryPop(out)) {
+                return true;
+            }
+            if (closed.load(std::memory_order_acquire)) {
+                return tryPop(out);
+            }
+
+            std::unique_lock<std::mutex> lock(waitMutex);
+            consumerSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            waitCv.wait(lock, [this] {
+                return headReady() || closed.load(std::memory_order_acquire);
+            });
+            consumerSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // Producatorii nu mai pot scrie; consumatorul goleste ce a ramas.
+    // Se apeleaza dupa ce producatorii si-au terminat push-urile.
+    void close() {
+        closed.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(waitMutex);
+        waitCv.notify_all();
+    }
+
+    bool isClosed() const { return closed.load(std::memory_order_acquire); }
+    size_t capacity() const { return mask + 1; }
+};
+
+#endif // MPSC_RING_BUFFER_HPP
@@ -0,0 +1,210 @@
+#ifndef OBJECT_POOL_HPP
+#define OBJECT_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "StripedCounter.hpp"
+
+/**
+ * ============================================================================
+ * ObjectPool<T>: obiecte refolosite, imprumutate ca std::unique_ptr
+ * ============================================================================
+ *
+ *     ObjectPool<Buffer> pool([] { return std::make_unique<Buffer>(4096); },
+ *                             [](Buffer& b) { b.clear(); });
+ *     ObjectPool<Buffer>::Handle buf = pool.acquire();
+ *     buf->append(...);
+ *     // la distrugerea handle-ului, obiectul revine in pool (nu e sters)
+ *
+ * - acquire() intoarce std::unique_ptr<T, Recycler>: deleter-ul apeleaza
+ *   reset hook-ul si pune obiectul inapoi in pool in loc sa-l stearga
+ * - Obiectele libere sunt tinute pe shard-uri (aliniate la 64 B); fiecare
+ *   thread foloseste shard-ul lui (currentThreadSlot), deci lock-ul e practic
+ *   necontestat. Shard gol: se fura din celelalte (try_lock), apoi factory
+ * - maxIdle limiteaza cate obiecte libere sunt pastrate (impartit pe shard-uri);
+ *   peste limita, obiectele returnate sunt sterse
+ * - Daca reset hook-ul arunca, obiectul e sters (nu ajunge inapoi in pool)
+ *
+ * Pool-ul trebuie sa traiasca mai mult decat toate obiectele imprumutate.
+ */
+struct ObjectPoolOptions {
+    size_t maxIdle = 1024;
+    size_t shards = 0;   // 0 = cate un shard per core
+};
+
+struct ObjectPoolStats {
+    uint64_t created = 0;     // obiecte noi din factory
+    uint64_t reused = 0;      // acquire-uri servite din pool
+    uint64_t recycled = 0;    // obiecte returnate si pastrate
+    uint64_t discarded = 0;   // obiecte returnate si sterse (pool plin / reset a aruncat)
+    size_t idle = 0;
+};
+
+template <typename T>
+class ObjectPool {
+public:
+    using Factory = std::function<std::unique_ptr<T>()>;
+    using Reset = std::function<void(T&)>;
+
+    // Deleter-ul handle-urilor: returneaza obiectul in pool
+    class Recycler {
+    private:
+        ObjectPool* pool = nullptr;
+
+    public:
+        Recycler() = default;
+        explicit Recycler(ObjectPool* p) noexcept : pool(p) {}
+
+        void operator()(T* object) const noexcept {
+            if (pool) {
+                pool->recycle(object);
+            } else {
+                delete object;
+            }
+        }
+    };
+
+    using Handle = std::unique_ptr<T, Recycler>;
+
+private:
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::vector<T*> idle;
+        uint64_t reused = 0;
+        uint64_t recycled = 0;
+        uint64_t discarded = 0;
+    };
+
+    Factory factory;
+    Reset reset;
+    std::unique_ptr<Shard[]> shards;
+    size_t shardCount;
+    size_t shardCapacity;
+    std::atomic<uint64_t> created{0};
+
+    static size_t defaultShards() {
+        size_t hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 8 : hw;
+    }
+
+    Shard& localShard() { return shards[currentThreadSlot() % shardCount]; }
+
+    // Apelat cu lock-ul shard-ului luat
+    static T* takeIdle(Shard& shard) {
+        if (shard.idle.empty()) {
+            return nullptr;
+        }
+        T* object = shard.idle.back();
+        shard.idle.pop_back();
+        ++shard.reused;
+        return object;
+    }
+
+    void recycle(T* object) noexcept {
+        if (reset) {
+            try {
+                reset(*object);
+            } catch (...) {
+                Shard& shard = localShard();
+                {
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    ++shard.discarded;
+                }
+                delete object;
+                return;
+            }
+        }
+        Shard& shard = localShard();
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.idle.size() < shardCapacity) {
+                shard.idle.push_back(object);   // capacitate rezervata: nu aloca
+                ++shard.recycled;
+                return;
+            }
+            ++shard.discarded;
+        }
+        delete object;
+    }
+
+public:
+    explicit ObjectPool(Factory f, Reset r = nullptr, ObjectPoolOptions options = ObjectPoolOptions())
+        : factory(std::move(f)), reset(std::move(r)) {
+        shardCount = options.shards ? options.shards : defaultShards();
+        shardCapacity = options.maxIdle / shardCount;
+        if (shardCapacity == 0 && options.maxIdle > 0) {
+            shardCapacity = 1;
+        }
+        shards.reset(new Shard[shardCount]);
+        for (size_t i = 0; i < shardCount; ++i) {
+            shards[i].idle.reserve(shardCapacity);
+        }
+    }
+
+    ~ObjectPool() { clear(); }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Obiect din pool (dupa reset) sau unul nou din factory
+    Handle acquire() {
+        Shard& local = localShard();
+        {
+            std::lock_guard<std::mutex> lock(local.mutex);
+            if (T* object = takeIdle(local)) {
+                return Handle(object, Recycler(this));
+            }
+        }
+        // Obiectele eliberate pe alte thread-uri ajung in shard-urile lor
+        for (size_t i = 0; i < shardCount; ++i) {
+            Shard& other = shards[i];
+            if (&other == &local) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(other.mutex, std::try_to_lock);
+            if (lock) {
+                if (T* object = takeIdle(other)) {
+                    return Handle(object, Recycler(this));
+                }
+            }
+        }
+        std::unique_ptr<T> fresh = factory();
+        created.fetch_add(1, std::memory_order_relaxed);
+        return Handle(fresh.release(), Recycler(this));
+    }
+
+    // Sterge toate obiectele libere (cele imprumutate nu sunt afectate)
+    void clear() {
+        for (size_t i = 0; i < shardCount; ++i) {
+            // Capacitatea rezervata ramane: recycle() nu trebuie sa aloce
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            for (T* object : shards[i].idle) {
+                delete object;
+            }
+            shards[i].idle.clear();
+        }
+    }
+
+    ObjectPoolStats stats() const {
+        ObjectPoolStats result;
+        result.created = created.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < shardCount; ++i) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            result.reused += shards[i].reused;
+            result.recycled += shards[i].recycled;
+            result.discarded += shards[i].discarded;
+            result.idle += shards[i].idle.size();
+        }
+        return result;
+    }
+};
+
+#endif // OBJECT_POOL_HPP
@@ -1,49 +1,98 @@
-#ifndef PERSON_HPP
-#define PERSON_HPP
-
-#include <string>
-
-/**
- * Clasa Person demonstreaza Item 10, 11, 12 din Effective C++
- * 
- * Item 10: Assignment operators return a reference to *this
- * Item 11: Handle assignment to self in operator=
- * Item 12: Copy all parts of an object
- */
-class Person {
-private:
-    std::string name;
-    int age;
-    std::string* address;  // pointer pentru a demonstra deep copy
-
-public:
-    // Constructor
-    Person(const std::string& name = "", int age = 0, const std::string& addr = "");
-    
-    // Copy constructor - Item 12: Copy all parts
-    Person(const Person& other);
-    
-    // Item 10 & 11: Assignment operator returns reference to *this
-    // si handleaza assignment to self
-    Person& operator=(const Person& rhs);
-    
-    // Destructor
-    ~Person();
-    
-    // Getters
-    std::string getName() const;
-    int getAge() const;
-    std::string getAddress() const;
-    
-    // Setters
-    void setName(const std::string& name);
-    void setAge(int age);
-    void setAddress(const std::string& addr);
-    
-    // Display
-    void display() const;
-};
-
-#endif // PERSON_HPP
-
-
+#ifndef PERSON_HPP
+#define PERSON_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * Clasa Person demonstreaza Item 10, 11, 12 din Effective C++
+ * 
+ * Item 10: Assignment operators return a reference to *this
+ * Item 11: Handle assignment to self in operator=
+ * Item 12: Copy all parts of an object
+ */
+class Person {
+private:
+    std::string name;
+    int age;
+    std::string address;  // inline: copierea nu mai face "new std::string"
+
+public:
+    // Constructor
+    Person(const std::string& name = "", int age = 0, const std::string& addr = "");
+    
+    // Copy constructor - Item 12: Copy all parts
+    Person(const Person& other);
+    
+    // Move constructor - fara alocari
+    Person(Person&& other) noexcept;
+    
+    // Item 10 & 11: Assignment operator returns reference to *this
+    // si handleaza assignment to self
+    Person& operator=(const Person& rhs);
+    
+    // Move assignment
+    Person& operator=(Person&& rhs) noexcept;
+    
+    // Schimba continutul, fara alocari si fara exceptii
+    void swap(Person& other) noexcept;
+    
+    // Destructor
+    ~Person();
+    
+    // Alocare din SlabPool<Person> (cache per thread, fara lock pe calea rapida)
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p, std::size_t size) noexcept;
+    
+    // Getters
+    std::string getName() const;
+    int getAge() const;
+    std::string getAddress() const;
+    
+    // Getters fara alocari: vederile sunt valide cat timp obiectul traieste
+    // si campul respectiv nu este modificat
+    std::string_view getNameView() const noexcept;
+    std::string_view getAddressView() const noexcept;
+    
+    // Setters
+    void setName(const std::string& name);
+    void setAge(int age);
+    void setAddress(const std::string& addr);
+    
+    // Display
+    void display() const;
+};
+
+inline void swap(Person& a, Person& b) noexcept {
+    a.swap(b);
+}
+
+inline std::string_view Person::getNameView() const noexcept {
+    return name;
+}
+
+inline std::string_view Person::getAddressView() const noexcept {
+    return address;
+}
+
+// Citire in bloc: umple out[0..count) (buffer al apelantului) cu vederi.
+// Template ca sa primeasca tipul exact al elementelor (Person sau Employee) -
+// un Employee* convertit la Person* ar strica aritmetica pe pointeri.
+template <typename T>
+void readNames(const T* people, size_t count, std::string_view* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = people[i].getNameView();
+    }
+}
+
+template <typename T>
+void readAddresses(const T* people, size_t count, std::string_view* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = people[i].getAddressView();
+    }
+}
+
+#endif // PERSON_HPP
+
+
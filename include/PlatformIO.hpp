@@ -0,0 +1,183 @@
+#ifndef PLATFORM_IO_HPP
+#define PLATFORM_IO_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+/**
+ * ============================================================================
+ * PositionalFile: RAII pentru un descriptor folosit cu I/O pozitional
+ * ============================================================================
+ *
+ * - readAt(offset, ...) citeste de la un offset explicit (pread pe POSIX,
+ *   ReadFile cu OVERLAPPED pe Windows), fara sa atinga pozitia curenta a
+ *   descriptorului - deci mai multe thread-uri pot citi simultan din acelasi
+ *   obiect fara niciun lock
+ * - writeAt(offset, ...) scrie pozitional (pwrite / WriteFile cu OVERLAPPED);
+ *   scrierile in intervale disjuncte nu au nevoie de lock intre ele
+ * - Pe Windows, un handle sincron serializeaza intern apelurile concurente:
+ *   rezultatul e corect, dar operatiile nu mai ruleaza in paralel
+ * - Daca deschiderea esueaza, isOpen() intoarce false (ca FileHandle::good())
+ */
+class PositionalFile {
+private:
+#ifdef _WIN32
+    HANDLE handle = INVALID_HANDLE_VALUE;
+#else
+    int fd = -1;
+#endif
+
+    void release() {
+#ifdef _WIN32
+        if (handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(handle);
+            handle = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+#endif
+    }
+
+public:
+    enum class Access { Read, ReadWrite };
+
+    PositionalFile() = default;
+
+    // Deschide un fisier existent (nu il creeaza si nu il trunchiaza)
+    explicit PositionalFile(const std::string& path, Access access = Access::Read) {
+#ifdef _WIN32
+        DWORD rights = access == Access::Read ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+        handle = CreateFileA(path.c_str(), rights,
+                             FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                             nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        fd = ::open(path.c_str(), (access == Access::Read ? O_RDONLY : O_RDWR) | O_CLOEXEC);
+#endif
+    }
+
+    ~PositionalFile() { release(); }
+
+    PositionalFile(const PositionalFile&) = delete;
+    PositionalFile& operator=(const PositionalFile&) = delete;
+
+#ifdef _WIN32
+    PositionalFile(PositionalFile&& other) noexcept : handle(other.handle) {
+        other.handle = INVALID_HANDLE_VALUE;
+    }
+
+    PositionalFile& operator=(PositionalFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            handle = other.handle;
+            other.handle = INVALID_HANDLE_VALUE;
+        }
+        return *this;
+    }
+
+    bool isOpen() const { return handle != INVALID_HANDLE_VALUE; }
+#else
+    PositionalFile(PositionalFile&& other) noexcept : fd(other.fd) { other.fd = -1; }
+
+    PositionalFile& operator=(PositionalFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            fd = other.fd;
+            other.fd = -1;
+        }
+        return *this;
+    }
+
+    bool isOpen() const { return fd >= 0; }
+#endif
+
+    // Citeste cel mult `count` octeti de la `offset`. Intoarce cati octeti au
+    // fost cititi (mai putini doar la sfarsitul fisierului sau la eroare).
+    size_t readAt(uint64_t offset, char* buffer, size_t count) const {
+        size_t total = 0;
+        while (total < count) {
+#ifdef _WIN32
+            OVERLAPPED ov{};
+            uint64_t at = offset + total;
+            ov.Offset = static_cast<DWORD>(at & 0xFFFFFFFFu);
+            ov.OffsetHigh = static_cast<DWORD>(at >> 32);
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(count - total, 1u << 30));
+            DWORD got = 0;
+            if (!ReadFile(handle, buffer + total, chunk, &got, &ov) || got == 0) {
+                break;
+            }
+#else
+            ssize_t got = ::pread(fd, buffer + total, count - total, static_cast<off_t>(offset + total));
+            if (got < 0 && errno == EINTR) {
+                continue;
+            }
+            if (got <= 0) {
+                break;
+            }
+#endif
+            total += static_cast<size_t>(got);
+        }
+        return total;
+    }
+
+    // Scrie toti cei `count` octeti la `offset`. false la eroare (ex: disc plin).
+    bool writeAt(uint64_t offset, const char* data, size_t count) {
+        size_t total = 0;
+        while (total < count) {
+#ifdef _WIN32
+            OVERLAPPED ov{};
+            uint64_t at = offset + total;
+            ov.Offset = static_cast<DWORD>(at & 0xFFFFFFFFu);
+            ov.OffsetHigh = static_cast<DWORD>(at >> 32);
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(count - total, 1u << 30));
+            DWORD put = 0;
+            if (!WriteFile(handle, data + total, chunk, &put, &ov) || put == 0) {
+                return false;
+            }
+#else
+            ssize_t put = ::pwrite(fd, data + total, count - total, static_cast<off_t>(offset + total));
+            if (put < 0 && errno == EINTR) {
+                continue;
+            }
+            if (put <= 0) {
+                return false;
+            }
+#endif
+            total += static_cast<size_t>(put);
+        }
+        return true;
+    }
+
+    // Seteaza dimensiunea fisierului (scurteaza sau extinde cu zerouri)
+    bool truncate(uint64_t length) {
+#ifdef _WIN32
+        FILE_END_OF_FILE_INFO info{};
+        info.EndOfFile.QuadPart = static_cast<LONGLONG>(length);
+        return SetFileInformationByHandle(handle, FileEndOfFileInfo, &info, sizeof(info)) != 0;
+#else
+        return ::ftruncate(fd, static_cast<off_t>(length)) == 0;
+#endif
+    }
+};
+
+#endif // PLATFORM_IO_HPP
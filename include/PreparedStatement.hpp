@@ -0,0 +1,79 @@
+#ifndef PREPARED_STATEMENT_HPP
+#define PREPARED_STATEMENT_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * PreparedStatement: interogare parametrizata, analizata o singura data
+ *
+ * Textul SQL este impartit la constructie in fragmente fixe, separate de
+ * placeholder-ele '?' (cele din interiorul literalilor '...' sunt ignorate).
+ * La executie, render() doar concateneaza fragmentele cu parametrii, fara
+ * sa mai parcurga SQL-ul. Parametrii sunt inserati ca literali, cu
+ * apostrofurile dublate (nu pot "iesi" din literal).
+ *
+ *     PreparedStatement stmt("SELECT * FROM users WHERE id = ? AND dept = ?");
+ *     stmt.render({"42", "IT"});  // ... WHERE id = '42' AND dept = 'IT'
+ */
+class PreparedStatement {
+private:
+    std::string sql;
+    std::vector<std::string> fragments;   // fragments.size() == parameterCount() + 1
+    size_t fixedLength = 0;
+
+public:
+    explicit PreparedStatement(std::string text) : sql(std::move(text)) {
+        std::string current;
+        bool inLiteral = false;
+        for (char c : sql) {
+            if (c == '\'') {
+                inLiteral = !inLiteral;
+            }
+            if (c == '?' && !inLiteral) {
+                fixedLength += current.size();
+                fragments.push_back(std::move(current));
+                current.clear();
+            } else {
+                current += c;
+            }
+        }
+        fixedLength += current.size();
+        fragments.push_back(std::move(current));
+    }
+
+    size_t parameterCount() const { return fragments.size() - 1; }
+    const std::string& getSql() const { return sql; }
+
+    // Arunca std::invalid_argument daca numarul de parametri nu se potriveste
+    std::string render(const std::vector<std::string>& params) const {
+        if (params.size() != parameterCount()) {
+            throw std::invalid_argument("PreparedStatement: " + std::to_string(parameterCount()) +
+                                        " parametri asteptati, " + std::to_string(params.size()) + " primiti");
+        }
+        size_t length = fixedLength;
+        for (const std::string& p : params) {
+            length += p.size() + 2;
+        }
+        std::string out;
+        out.reserve(length);
+        out += fragments[0];
+        for (size_t i = 0; i < params.size(); ++i) {
+            out += '\'';
+            for (char c : params[i]) {
+                if (c == '\'') {
+                    out += '\'';
+                }
+                out += c;
+            }
+            out += '\'';
+            out += fragments[i + 1];
+        }
+        return out;
+    }
+};
+
+#endif // PREPARED_STATEMENT_HPP
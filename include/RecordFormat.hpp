@@ -0,0 +1,231 @@
+#ifndef RECORD_FORMAT_HPP
+#define RECORD_FORMAT_HPP
+
+#include "Employee.hpp"
+#include "EmployeeStore.hpp"
+#include "MappedFile.hpp"
+#include "Person.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * ============================================================================
+ * Format binar pentru Person/Employee: scriere in flux, citire zero-copy
+ * ============================================================================
+ *
+ *     RecordWriter writer("employees.ecpr", RecordKind::Employee);
+ *     for (const Employee& e : employees) writer.write(e);
+ *     writer.close();
+ *
+ *     RecordReader reader("employees.ecpr");   // mmap, fara parsare
+ *     for (size_t b = 0; b < reader.blockCount(); ++b) {
+ *         const RecordBlock& block = reader.block(b);
+ *         for (size_t i = 0; i < block.size(); ++i) use(block.name(i), block.salary(i));
+ *     }
+ *
+ * Layout (toate campurile de latime fixa, in ordinea octetilor masinii care
+ * scrie - fara conversie; endianTag face ca un reader cu alta ordine sa
+ * refuze fisierul in loc sa citeasca valori gresite):
+ *
+ *   antet fisier (16 B): "ECPR", version u16, kind u16, endianTag u32, rezervat u32
+ *   blocuri, pana la sfarsitul fisierului, fiecare aliniat la 8 B:
+ *     antet bloc (16 B): recordCount u32, stringBytes u32, blockBytes u64
+ *     [Employee] salary  f64 x recordCount      (coloana)
+ *                age     i32 x recordCount      (coloana)
+ *     [Person]   age     i32 x recordCount
+ *     tabela de offset-uri: u32 x (recordCount * stringuri_per_record + 1)
+ *     bytes-ii stringurilor, concatenati; padding pana la multiplu de 8
+ *
+ * Aliniere: maparea incepe la o pagina, antetul de fisier are 16 B si fiecare
+ * bloc are o lungime multiplu de 8, deci coloana de salarii e aliniata la 8,
+ * iar cea de varste si tabela de offset-uri la 4. Reader-ul foloseste
+ * coloanele direct ca const double* / const int32_t* / const uint32_t*.
+ *
+ * - Stringul j al record-ului i este [offsets[i*k + j], offsets[i*k + j + 1]),
+ *   k = 2 (name, address) pentru Person si 4 (+ employeeId, department)
+ *   pentru Employee. Record-urile nu contin pointeri sau lungimi proprii
+ * - Writer-ul strange cate un bloc in memorie (coloane + stringuri) si il
+ *   scrie dintr-o data: memorie constanta, oricat de mare ar fi fisierul.
+ *   Nu se rescrie nimic la final (numarul de record-uri nu e in antet)
+ * - Reader-ul mapeaza fisierul si citeste doar antetele de bloc; coloanele si
+ *   string_view-urile pointeaza direct in mapare (valide cat traieste reader-ul)
+ * - Versiuni: un reader refuza fisierele cu o versiune mai noua decat
+ *   kVersion (std::runtime_error); campurile rezervate sunt 0
+ * - Constructorul verifica structura (antete, dimensiuni de bloc); verify()
+ *   verifica si fiecare offset, pentru fisiere din surse nesigure
+ */
+enum class RecordKind : uint16_t {
+    Person = 1,
+    Employee = 2
+};
+
+namespace recordformat {
+
+constexpr char kMagic[4] = {'E', 'C', 'P', 'R'};
+constexpr uint16_t kVersion = 1;
+constexpr uint32_t kEndianTag = 0x01020304;
+constexpr size_t kFileHeaderSize = 16;
+constexpr size_t kBlockHeaderSize = 16;
+constexpr size_t kDefaultBlockRecords = 8192;
+
+constexpr size_t stringsPerRecord(RecordKind kind) {
+    return kind == RecordKind::Employee ? 4 : 2;
+}
+
+constexpr size_t alignUp8(size_t n) {
+    return (n + 7) & ~static_cast<size_t>(7);
+}
+
+// Campurile din antete (fisier, bloc), citite/scrise octet cu octet
+template <typename T>
+inline T load(const char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template <typename T>
+inline void store(char* p, T value) {
+    std::memcpy(p, &value, sizeof(T));
+}
+
+} // namespace recordformat
+
+// ============================================================================
+// RecordWriter: scrie record-uri in flux, cate un bloc odata
+// ============================================================================
+class RecordWriter {
+private:
+    std::ofstream out;
+    RecordKind recordKind;
+    size_t blockRecords;
+    size_t written = 0;
+
+    // Blocul curent, pe coloane
+    std::vector<double> salaries;
+    std::vector<int32_t> ages;
+    std::vector<uint32_t> offsets;   // incepe cu 0
+    std::string strings;
+    std::vector<char> blockBuffer;   // blocul serializat (refolosit)
+
+    void appendString(std::string_view s);
+    void endRecord();
+    void flushBlock();
+
+public:
+    // Arunca std::runtime_error daca fisierul nu poate fi creat
+    RecordWriter(const std::string& path, RecordKind kind,
+                 size_t recordsPerBlock = recordformat::kDefaultBlockRecords);
+
+    // Inchide fisierul; erorile de scriere sunt raportate doar de close()
+    ~RecordWriter();
+
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+
+    // Employee intr-un fisier de Person: se scrie doar partea de Person.
+    // Person intr-un fisier de Employee: std::invalid_argument
+    void write(const Person& person);
+    void write(const Employee& employee);
+
+    // Variante fara obiecte intermediare
+    void writePerson(std::string_view name, int age, std::string_view address);
+    void writeEmployee(std::string_view name, int age, std::string_view address,
+                       std::string_view employeeId, double salary, std::string_view department);
+
+    // Scrie blocul curent (incomplet) si goleste buffer-ul fluxului
+    void flush();
+
+    // flush() + inchidere; arunca std::runtime_error daca scrierea a esuat
+    void close();
+
+    RecordKind kind() const { return recordKind; }
+    size_t recordsWritten() const { return written; }
+};
+
+// ============================================================================
+// RecordBlock: vedere peste un bloc din fisierul mapat
+// ============================================================================
+class RecordBlock {
+private:
+    friend class RecordReader;
+
+    const double* salaries = nullptr;   // nullptr pentru fisiere de Person
+    const int32_t* ages = nullptr;
+    const uint32_t* offsets = nullptr;
+    const char* strings = nullptr;
+    size_t count = 0;
+    size_t stride = 2;                  // stringuri per record
+    size_t firstRecord = 0;             // indexul global al primului record
+
+    std::string_view string(size_t record, size_t field) const {
+        size_t j = record * stride + field;
+        return std::string_view(strings + offsets[j], offsets[j + 1] - offsets[j]);
+    }
+
+public:
+    size_t size() const { return count; }
+    size_t first() const { return firstRecord; }
+
+    int age(size_t i) const { return ages[i]; }
+    std::string_view name(size_t i) const { return string(i, 0); }
+    std::string_view address(size_t i) const { return string(i, 1); }
+
+    // Doar pentru fisiere de Employee (0 / "" altfel)
+    double salary(size_t i) const { return salaries ? salaries[i] : 0.0; }
+    std::string_view employeeId(size_t i) const { return stride > 2 ? string(i, 2) : std::string_view(); }
+    std::string_view department(size_t i) const { return stride > 2 ? string(i, 3) : std::string_view(); }
+
+    // Coloanele, direct din mapare (salaryColumn() e nullptr pentru Person)
+    const double* salaryColumn() const { return salaries; }
+    const int32_t* ageColumn() const { return ages; }
+};
+
+// ============================================================================
+// RecordReader: mapeaza fisierul; record-urile sunt citite pe loc
+// ============================================================================
+class RecordReader {
+private:
+    MappedFile file;
+    RecordKind recordKind = RecordKind::Person;
+    uint16_t fileVersion = 0;
+    size_t total = 0;
+    std::vector<RecordBlock> blocks;
+
+    const RecordBlock& blockOf(size_t index, size_t& row) const;
+
+public:
+    // Arunca std::runtime_error daca fisierul lipseste sau nu e valid
+    explicit RecordReader(const std::string& path);
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    RecordKind kind() const { return recordKind; }
+    uint16_t version() const { return fileVersion; }
+    size_t size() const { return total; }
+
+    size_t blockCount() const { return blocks.size(); }
+    const RecordBlock& block(size_t b) const { return blocks[b]; }
+
+    // Acces aleator (cautare binara in blocuri); arunca std::out_of_range
+    std::string_view name(size_t index) const;
+    int age(size_t index) const;
+
+    // Obiecte complete (copiaza stringurile)
+    Person person(size_t index) const;
+    Employee employee(size_t index) const;   // doar pentru fisiere de Employee
+
+    // Verifica fiecare offset din tabelele de stringuri (O(stringuri))
+    bool verify() const;
+};
+
+// Adauga toate record-urile unui fisier de Employee in store; intoarce numarul lor
+size_t loadEmployees(const RecordReader& reader, EmployeeStore& store);
+
+#endif // RECORD_FORMAT_HPP
@@ -1,318 +1,938 @@
-#ifndef RESOURCE_MANAGER_HPP
-#define RESOURCE_MANAGER_HPP
-
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <stdexcept>
-
-/**
- * ============================================================================
- * ITEM 13: Use objects to manage resources (RAII - Resource Acquisition Is Initialization)
- * ============================================================================
- * 
- * Principiul RAII: Resursele sunt achizitionate in constructor si eliberate in destructor.
- * Acest lucru garanteaza ca resursele sunt eliberate chiar daca apar exceptii.
- * 
- * Exemple de resurse: memorie, file handles, mutex locks, conexiuni de retea, etc.
- */
-
-// ============================================================================
-// Exemplu 1: FileHandle - RAII pentru file descriptors
-// ============================================================================
-class FileHandle {
-private:
-    std::fstream file;
-    std::string filename;
-    bool isOpen;
-
-public:
-    // Constructor - achizitioneaza resursa (deschide fisierul)
-    explicit FileHandle(const std::string& fname, std::ios::openmode mode = std::ios::in | std::ios::out) 
-        : filename(fname), isOpen(false) {
-        std::cout << "[FileHandle] Deschidere fisier: " << fname << std::endl;
-        file.open(fname, mode);
-        if (file.is_open()) {
-            isOpen = true;
-            std::cout << "[FileHandle] Fisier deschis cu succes!" << std::endl;
-        } else {
-            std::cout << "[FileHandle] EROARE: Nu s-a putut deschide fisierul!" << std::endl;
-        }
-    }
-    
-    // Destructor - elibereaza resursa (inchide fisierul)
-    ~FileHandle() {
-        if (isOpen && file.is_open()) {
-            file.close();
-            std::cout << "[FileHandle] Fisier inchis automat: " << filename << std::endl;
-        }
-    }
-    
-    // Item 14: Disable copying (fisierul nu poate fi copiat)
-    FileHandle(const FileHandle&) = delete;
-    FileHandle& operator=(const FileHandle&) = delete;
-    
-    // Permite move semantics (C++11)
-    FileHandle(FileHandle&& other) noexcept 
-        : file(std::move(other.file)), filename(std::move(other.filename)), isOpen(other.isOpen) {
-        other.isOpen = false;
-    }
-    
-    FileHandle& operator=(FileHandle&& other) noexcept {
-        if (this != &other) {
-            if (isOpen && file.is_open()) {
-                file.close();
-            }
-            file = std::move(other.file);
-            filename = std::move(other.filename);
-            isOpen = other.isOpen;
-            other.isOpen = false;
-        }
-        return *this;
-    }
-    
-    // Metode pentru operatii cu fisierul
-    void write(const std::string& data) {
-        if (isOpen && file.is_open()) {
-            file << data;
-            std::cout << "[FileHandle] Scris: " << data << std::endl;
-        }
-    }
-    
-    std::string readLine() {
-        std::string line;
-        if (isOpen && file.is_open() && std::getline(file, line)) {
-            return line;
-        }
-        return "";
-    }
-    
-    std::string readAll() {
-        std::string content;
-        std::string line;
-        if (isOpen && file.is_open()) {
-            file.seekg(0);  // Reset to beginning
-            while (std::getline(file, line)) {
-                content += line + "\n";
-            }
-        }
-        return content;
-    }
-    
-    bool good() const { return isOpen && file.is_open(); }
-    
-    std::fstream& getStream() { return file; }
-};
-
-// ============================================================================
-// Exemplu 2: MemoryBlock - RAII pentru memorie alocata dinamic
-// ============================================================================
-class MemoryBlock {
-private:
-    int* data;
-    size_t size;
-
-public:
-    // Constructor - aloca memorie
-    explicit MemoryBlock(size_t sz) : size(sz) {
-        std::cout << "[MemoryBlock] Alocare " << sz << " integers" << std::endl;
-        data = new int[sz];
-        for (size_t i = 0; i < sz; ++i) {
-            data[i] = 0;
-        }
-    }
-    
-    // Destructor - elibereaza memorie
-    ~MemoryBlock() {
-        std::cout << "[MemoryBlock] Eliberare memorie (" << size << " integers)" << std::endl;
-        delete[] data;
-    }
-    
-    // Item 14: Deep copy (comportament de copiere pentru resurse)
-    MemoryBlock(const MemoryBlock& other) : size(other.size) {
-        std::cout << "[MemoryBlock] Copy constructor - deep copy" << std::endl;
-        data = new int[size];
-        for (size_t i = 0; i < size; ++i) {
-            data[i] = other.data[i];
-        }
-    }
-    
-    MemoryBlock& operator=(const MemoryBlock& rhs) {
-        std::cout << "[MemoryBlock] Copy assignment - deep copy" << std::endl;
-        if (this != &rhs) {
-            delete[] data;
-            size = rhs.size;
-            data = new int[size];
-            for (size_t i = 0; i < size; ++i) {
-                data[i] = rhs.data[i];
-            }
-        }
-        return *this;
-    }
-    
-    // Move semantics
-    MemoryBlock(MemoryBlock&& other) noexcept : data(other.data), size(other.size) {
-        std::cout << "[MemoryBlock] Move constructor" << std::endl;
-        other.data = nullptr;
-        other.size = 0;
-    }
-    
-    MemoryBlock& operator=(MemoryBlock&& other) noexcept {
-        std::cout << "[MemoryBlock] Move assignment" << std::endl;
-        if (this != &other) {
-            delete[] data;
-            data = other.data;
-            size = other.size;
-            other.data = nullptr;
-            other.size = 0;
-        }
-        return *this;
-    }
-    
-    int& operator[](size_t index) {
-        if (index >= size) throw std::out_of_range("Index out of bounds");
-        return data[index];
-    }
-    
-    size_t getSize() const { return size; }
-};
-
-// ============================================================================
-// Exemplu 3: DatabaseConnection - RAII pentru conexiuni
-// ============================================================================
-class DatabaseConnection {
-private:
-    std::string connectionString;
-    bool connected;
-    int connectionId;
-    static int nextId;
-
-public:
-    explicit DatabaseConnection(const std::string& connStr) 
-        : connectionString(connStr), connected(false), connectionId(nextId++) {
-        std::cout << "[DB " << connectionId << "] Conectare la: " << connStr << std::endl;
-        // Simulam conectarea
-        connected = true;
-        std::cout << "[DB " << connectionId << "] Conectat cu succes!" << std::endl;
-    }
-    
-    ~DatabaseConnection() {
-        if (connected) {
-            std::cout << "[DB " << connectionId << "] Deconectare automata" << std::endl;
-            connected = false;
-        }
-    }
-    
-    // Item 14: Disable copying (conexiunea nu poate fi copiata)
-    DatabaseConnection(const DatabaseConnection&) = delete;
-    DatabaseConnection& operator=(const DatabaseConnection&) = delete;
-    
-    // Move semantics
-    DatabaseConnection(DatabaseConnection&& other) noexcept 
-        : connectionString(std::move(other.connectionString)), 
-          connected(other.connected), connectionId(other.connectionId) {
-        other.connected = false;
-    }
-    
-    void executeQuery(const std::string& query) {
-        if (connected) {
-            std::cout << "[DB " << connectionId << "] Executare: " << query << std::endl;
-        }
-    }
-    
-    bool isConnected() const { return connected; }
-};
-
-// Initializare static member
-inline int DatabaseConnection::nextId = 1;
-
-// ============================================================================
-// Functii demonstrative pentru Item 13
-// ============================================================================
-inline void demonstrateRAII_FileHandle() {
-    std::cout << "\n--- RAII cu FileHandle ---\n" << std::endl;
-    
-    {
-        std::cout << "Intram in scope..." << std::endl;
-        FileHandle file("test_raii.txt", std::ios::out | std::ios::trunc);
-        
-        if (file.good()) {
-            file.write("Linia 1: RAII in actiune!\n");
-            file.write("Linia 2: Fisierul se va inchide automat.\n");
-        }
-        
-        std::cout << "Iesim din scope..." << std::endl;
-    } // FileHandle destructor apelat automat aici!
-    
-    std::cout << "\nFisierul a fost inchis automat la iesirea din scope!\n" << std::endl;
-}
-
-inline void demonstrateRAII_MemoryBlock() {
-    std::cout << "\n--- RAII cu MemoryBlock ---\n" << std::endl;
-    
-    {
-        std::cout << "Intram in scope..." << std::endl;
-        MemoryBlock block(5);
-        
-        for (size_t i = 0; i < block.getSize(); ++i) {
-            block[i] = static_cast<int>(i * 10);
-        }
-        
-        std::cout << "Valori: ";
-        for (size_t i = 0; i < block.getSize(); ++i) {
-            std::cout << block[i] << " ";
-        }
-        std::cout << std::endl;
-        
-        std::cout << "Iesim din scope..." << std::endl;
-    } // MemoryBlock destructor apelat automat!
-    
-    std::cout << "\nMemoria a fost eliberata automat!\n" << std::endl;
-}
-
-inline void demonstrateRAII_ExceptionSafety() {
-    std::cout << "\n--- RAII: Exception Safety ---\n" << std::endl;
-    
-    try {
-        std::cout << "Intram in try block..." << std::endl;
-        MemoryBlock block(3);
-        DatabaseConnection db("localhost:5432/mydb");
-        
-        block[0] = 100;
-        db.executeQuery("SELECT * FROM users");
-        
-        std::cout << "Simulam o exceptie..." << std::endl;
-        throw std::runtime_error("Eroare simulata!");
-        
-        // Acest cod nu se executa
-        block[1] = 200;
-        
-    } catch (const std::exception& e) {
-        std::cout << "\nExceptie prinsa: " << e.what() << std::endl;
-        std::cout << "DAR resursele au fost eliberate automat de destructori!\n" << std::endl;
-    }
-}
-
-inline void demonstrateItem13() {
-    std::cout << "\n";
-    std::cout << "============================================================\n";
-    std::cout << "  ITEM 13: Use objects to manage resources (RAII)\n";
-    std::cout << "============================================================\n";
-    
-    std::cout << "\nPrincipiul RAII:" << std::endl;
-    std::cout << "- Resursa este achizitionata in CONSTRUCTOR" << std::endl;
-    std::cout << "- Resursa este eliberata in DESTRUCTOR" << std::endl;
-    std::cout << "- Garanteaza eliberarea chiar si la exceptii!\n" << std::endl;
-    
-    demonstrateRAII_FileHandle();
-    demonstrateRAII_MemoryBlock();
-    demonstrateRAII_ExceptionSafety();
-    
-    std::cout << "\n--- Avantajele RAII ---" << std::endl;
-    std::cout << "1. Nu poti uita sa eliberezi resursa" << std::endl;
-    std::cout << "2. Exception-safe: resursa e eliberata si la exceptii" << std::endl;
-    std::cout << "3. Cod mai curat, fara cleanup manual" << std::endl;
-    std::cout << "4. Ownership clar al resurselor\n" << std::endl;
-}
-
-#endif // RESOURCE_MANAGER_HPP
+#ifndef RESOURCE_MANAGER_HPP
+#define RESOURCE_MANAGER_HPP
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include <initializer_list>
+#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "Allocators.hpp"
+#include "AsyncExecutor.hpp"
+#include "CowBuffer.hpp"
+#include "ConnectionPool.hpp"
+#include "MappedFile.hpp"
+#include "PreparedStatement.hpp"
+#include "SimdKernels.hpp"
+#include "SimulatedDatabase.hpp"
+#include "Logger.hpp"
+
+/**
+ * ============================================================================
+ * ITEM 13: Use objects to manage resources (RAII - Resource Acquisition Is Initialization)
+ * ============================================================================
+ * 
+ * Principiul RAII: Resursele sunt achizitionate in constructor si eliberate in destructor.
+ * Acest lucru garanteaza ca resursele sunt eliberate chiar daca apar exceptii.
+ * 
+ * Exemple de resurse: memorie, file handles, mutex locks, conexiuni de retea, etc.
+ */
+
+// ============================================================================
+// Exemplu 1: FileHandle - RAII pentru file descriptors
+// ============================================================================
+class FileHandle {
+private:
+    std::fstream file;
+    std::string filename;
+    bool isOpen;
+    MappedFile mapping;  // mod zero-copy (optional)
+    
+    // Buffer in user-space pentru scrieri mari (0 = scrieri directe in stream)
+    std::vector<char> writeBuffer;
+    size_t buffered = 0;
+    bool verbose = true;  // diagnosticul din write(); append/writev nu scriu niciodata la consola
+    
+    // Goleste buffer-ul propriu in stream (fara flush la nivel de OS)
+    void drainWriteBuffer() {
+        if (buffered > 0 && isOpen && file.is_open()) {
+            file.write(writeBuffer.data(), static_cast<std::streamsize>(buffered));
+        }
+        buffered = 0;
+    }
+
+public:
+    // Constructor - achizitioneaza resursa (deschide fisierul)
+    explicit FileHandle(const std::string& fname, std::ios::openmode mode = std::ios::in | std::ios::out) 
+        : filename(fname), isOpen(false) {
+        LOG_TRACE("[FileHandle] Deschidere fisier: " << fname);
+        file.open(fname, mode);
+        if (file.is_open()) {
+            isOpen = true;
+            LOG_TRACE("[FileHandle] Fisier deschis cu succes!");
+        } else {
+            LOG_ERROR("[FileHandle] EROARE: Nu s-a putut deschide fisierul!");
+        }
+    }
+    
+    // Destructor - elibereaza resursa (inchide fisierul)
+    ~FileHandle() {
+        if (isOpen && file.is_open()) {
+            drainWriteBuffer();
+            file.close();
+            LOG_TRACE("[FileHandle] Fisier inchis automat: " << filename);
+        }
+    }
+    
+    // Item 14: Disable copying (fisierul nu poate fi copiat)
+    FileHandle(const FileHandle&) = delete;
+    FileHandle& operator=(const FileHandle&) = delete;
+    
+    // Permite move semantics (C++11)
+    FileHandle(FileHandle&& other) noexcept 
+        : file(std::move(other.file)), filename(std::move(other.filename)), isOpen(other.isOpen),
+          mapping(std::move(other.mapping)), writeBuffer(std::move(other.writeBuffer)),
+          buffered(other.buffered), verbose(other.verbose) {
+        other.isOpen = false;
+        other.buffered = 0;
+    }
+    
+    FileHandle& operator=(FileHandle&& other) noexcept {
+        if (this != &other) {
+            if (isOpen && file.is_open()) {
+                drainWriteBuffer();
+                file.close();
+            }
+            file = std::move(other.file);
+            filename = std::move(other.filename);
+            isOpen = other.isOpen;
+            mapping = std::move(other.mapping);
+            writeBuffer = std::move(other.writeBuffer);
+            buffered = other.buffered;
+            verbose = other.verbose;
+            other.isOpen = false;
+            other.buffered = 0;
+        }
+        return *this;
+    }
+    
+    // Metode pentru operatii cu fisierul
+    void write(const std::string& data) {
+        if (isOpen && file.is_open()) {
+            append(data);
+            if (verbose) {
+                LOG_DEBUG("[FileHandle] Scris: " << data);
+            }
+        }
+    }
+    
+    // ------------------------------------------------------------------------
+    // Scriere bulk, fara diagnostic la consola
+    // ------------------------------------------------------------------------
+    
+    // Dimensiunea buffer-ului user-space (ex: 1 MiB). 0 = fara buffer propriu.
+    void setWriteBuffer(size_t bytes) {
+        drainWriteBuffer();
+        writeBuffer.assign(bytes, '\0');
+        writeBuffer.shrink_to_fit();
+    }
+    
+    // Opreste/porneste mesajul "[FileHandle] Scris: ..." din write()
+    void setVerbose(bool enabled) { verbose = enabled; }
+    
+    void append(std::string_view data) {
+        if (!isOpen || !file.is_open()) {
+            return;
+        }
+        if (buffered + data.size() > writeBuffer.size()) {
+            drainWriteBuffer();
+            if (data.size() >= writeBuffer.size()) {
+                // Bucati mai mari decat buffer-ul merg direct, fara copiere
+                file.write(data.data(), static_cast<std::streamsize>(data.size()));
+                return;
+            }
+        }
+        std::char_traits<char>::copy(writeBuffer.data() + buffered, data.data(), data.size());
+        buffered += data.size();
+    }
+    
+    // Scrie mai multe bucati dintr-un singur apel (in stilul writev)
+    void writev(const std::string_view* parts, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            append(parts[i]);
+        }
+    }
+    
+    void writev(std::initializer_list<std::string_view> parts) {
+        writev(parts.begin(), parts.size());
+    }
+    
+    // Goleste buffer-ul propriu si pe cel al stream-ului catre OS
+    void flush() {
+        if (isOpen && file.is_open()) {
+            drainWriteBuffer();
+            file.flush();
+        }
+    }
+    
+    std::string readLine() {
+        drainWriteBuffer();
+        std::string line;
+        if (isOpen && file.is_open() && std::getline(file, line)) {
+            return line;
+        }
+        return "";
+    }
+    
+    std::string readAll() {
+        drainWriteBuffer();
+        std::string content;
+        std::string line;
+        if (isOpen && file.is_open()) {
+            file.seekg(0);  // Reset to beginning
+            while (std::getline(file, line)) {
+                content += line + "\n";
+            }
+        }
+        return content;
+    }
+    
+    // Mod zero-copy: mapeaza fisierul read-only si intoarce o vedere peste el.
+    // Vederea ramane valida pana la unmap() sau distrugerea FileHandle.
+    // Reflecta continutul de la momentul maparii (scrierile ulterioare cer remap).
+    std::string_view mapAll() {
+        if (!mapping.isMapped()) {
+            flush();  // datele din buffer-e trebuie sa ajunga in fisier
+            mapping = MappedFile(filename);
+        }
+        return mapping.view();
+    }
+    
+    // Liniile fisierului mapat, ca string_view-uri (fara alocari)
+    LineRange mappedLines() { return LineRange(mapAll()); }
+    
+    void unmap() { mapping = MappedFile(); }
+    
+    bool isMapped() const { return mapping.isMapped(); }
+    
+    bool good() const { return isOpen && file.is_open(); }
+    
+    std::fstream& getStream() { return file; }
+};
+
+// ============================================================================
+// Exemplu 2: MemoryBlock - RAII pentru memorie alocata dinamic
+// ============================================================================
+
+// Tag pentru constructorul care nu initializeaza elementele (buffere ce vor fi
+// suprascrise imediat - evita o trecere inutila prin memorie)
+struct UninitializedTag {
+    explicit UninitializedTag() = default;
+};
+inline constexpr UninitializedTag uninitialized{};
+
+/**
+ * BasicMemoryBlock<T, Alloc>: bloc de T-uri cu alocator configurabil
+ * - std::allocator<T>        - heap-ul general (implicit)
+ * - AlignedAllocator<T>      - aliniat la 64 B / HugePageAllocator<T> - pagini mari
+ * - ArenaAllocator<T>        - bump-pointer dintr-o Arena; eliberarea e gratuita,
+ *                              memoria se recupereaza la Arena::reset()
+ *
+ * Copierea aloca prin alocatorul propriu (select_on_container_copy_construction
+ * pentru copy constructor); mutarea muta si alocatorul.
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class BasicMemoryBlock {
+private:
+    using Traits = std::allocator_traits<Alloc>;
+
+    Alloc alloc;
+    T* data;
+    size_t size;
+
+    T* allocateN(size_t n) { return n ? Traits::allocate(alloc, n) : nullptr; }
+
+    void deallocateN(T* p, size_t n) noexcept {
+        if (p) {
+            Traits::deallocate(alloc, p, n);
+        }
+    }
+
+    void release() noexcept {
+        if (data) {
+            std::destroy_n(data, size);
+            deallocateN(data, size);
+        }
+    }
+
+    // Tipurile trivial copiabile se copiaza cu memcpy, restul element cu element
+    static void copyConstruct(T* dst, const T* src, size_t n) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            simd::copy(dst, src, n);
+        } else {
+            std::uninitialized_copy_n(src, n, dst);
+        }
+    }
+
+    static constexpr bool kSimdInt = std::is_same_v<T, int32_t>;
+
+    // Aloca n elemente si le construieste cu init(p); elibereaza daca init arunca
+    template <typename Init>
+    T* allocateAndInit(size_t n, Init init) {
+        T* p = allocateN(n);
+        try {
+            init(p);
+        } catch (...) {
+            deallocateN(p, n);
+            throw;
+        }
+        return p;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    // Constructor - aloca memorie si initializeaza elementele cu valoarea implicita (0)
+    explicit BasicMemoryBlock(size_t sz, const Alloc& a = Alloc()) : alloc(a), data(nullptr), size(sz) {
+        LOG_TRACE("[MemoryBlock] Alocare " << sz << " elemente");
+        data = allocateAndInit(sz, [sz](T* p) { std::uninitialized_value_construct_n(p, sz); });
+    }
+
+    // Fara initializare: pentru tipuri trivial construibile continutul e nedefinit
+    BasicMemoryBlock(size_t sz, UninitializedTag, const Alloc& a = Alloc()) : alloc(a), data(nullptr), size(sz) {
+        LOG_TRACE("[MemoryBlock] Alocare " << sz << " elemente (neinitializate)");
+        data = allocateAndInit(sz, [sz](T* p) { std::uninitialized_default_construct_n(p, sz); });
+    }
+    
+    // Destructor - elibereaza memorie
+    ~BasicMemoryBlock() {
+        LOG_TRACE("[MemoryBlock] Eliberare memorie (" << size << " elemente)");
+        release();
+    }
+    
+    // Item 14: Deep copy (comportament de copiere pentru resurse)
+    BasicMemoryBlock(const BasicMemoryBlock& other)
+        : alloc(Traits::select_on_container_copy_construction(other.alloc)), data(nullptr), size(other.size) {
+        LOG_TRACE("[MemoryBlock] Copy constructor - deep copy");
+        data = allocateAndInit(size, [&other](T* p) { copyConstruct(p, other.data, other.size); });
+    }
+    
+    // Copia se face inainte de eliberarea vechiului buffer (strong guarantee)
+    BasicMemoryBlock& operator=(const BasicMemoryBlock& rhs) {
+        LOG_TRACE("[MemoryBlock] Copy assignment - deep copy");
+        if (this != &rhs) {
+            T* fresh = allocateAndInit(rhs.size, [&rhs](T* p) { copyConstruct(p, rhs.data, rhs.size); });
+            release();
+            data = fresh;
+            size = rhs.size;
+        }
+        return *this;
+    }
+    
+    // Move semantics. Fara LOG_TRACE: formatarea mesajului aloca si ar putea
+    // arunca dintr-o functie noexcept (std::terminate)
+    BasicMemoryBlock(BasicMemoryBlock&& other) noexcept
+        : alloc(std::move(other.alloc)), data(other.data), size(other.size) {
+        other.data = nullptr;
+        other.size = 0;
+    }
+    
+    BasicMemoryBlock& operator=(BasicMemoryBlock&& other) noexcept {
+        if (this != &other) {
+            release();
+            alloc = std::move(other.alloc);
+            data = other.data;
+            size = other.size;
+            other.data = nullptr;
+            other.size = 0;
+        }
+        return *this;
+    }
+    
+    T& operator[](size_t index) {
+        if (index >= size) throw std::out_of_range("Index out of bounds");
+        return data[index];
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size) throw std::out_of_range("Index out of bounds");
+        return data[index];
+    }
+    
+    size_t getSize() const { return size; }
+
+    allocator_type getAllocator() const { return alloc; }
+
+    // Acces nevalidat pentru buclele fierbinti: operator[] ramane varianta sigura
+    T* getData() { return data; }
+    const T* getData() const { return data; }
+    T* begin() { return data; }
+    T* end() { return data + size; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+
+    // --- Kernel-uri (SIMD pentru int32, algoritmi standard pentru restul) ---
+    void fill(const T& value) {
+        if constexpr (kSimdInt) {
+            simd::fill(data, size, value);
+        } else {
+            std::fill_n(data, size, value);
+        }
+    }
+
+    // Pentru int32 suma se acumuleaza pe 64 de biti
+    auto sum() const {
+        if constexpr (kSimdInt) {
+            return simd::sum(data, size);
+        } else {
+            return std::accumulate(begin(), end(), T{});
+        }
+    }
+
+    std::pair<T, T> minMax() const {
+        if (size == 0) throw std::out_of_range("minMax pe un bloc gol");
+        if constexpr (kSimdInt) {
+            return simd::minMax(data, size);
+        } else {
+            auto [lo, hi] = std::minmax_element(begin(), end());
+            return {*lo, *hi};
+        }
+    }
+
+    // x = f(x) pentru fiecare element; bucla pe pointeri, vectorizabila de compilator
+    template <typename F>
+    void transform(F f) {
+        for (T* p = data; p != data + size; ++p) {
+            *p = f(*p);
+        }
+    }
+
+    // x = x * mul + add (modulo 2^32 pentru int32)
+    void transformAffine(T mul, T add) {
+        if constexpr (kSimdInt) {
+            simd::transformAffine(data, data, size, mul, add);
+        } else {
+            transform([mul, add](const T& x) { return x * mul + add; });
+        }
+    }
+};
+
+using MemoryBlock = BasicMemoryBlock<int>;
+
+template <typename T>
+using AlignedMemoryBlock = BasicMemoryBlock<T, AlignedAllocator<T>>;
+
+template <typename T>
+using ArenaMemoryBlock = BasicMemoryBlock<T, ArenaAllocator<T>>;
+
+/**
+ * CowMemoryBlock: MemoryBlock cu copy-on-write
+ * - Copierea partajeaza buffer-ul (O(1)); prima scriere printr-o copie
+ *   partajata o duplica. Citirile (operator[] const, sum, minMax) nu copiaza.
+ * - fill/transformAffine pe un bloc partajat scriu direct in buffer-ul nou
+ *   (o singura trecere prin memorie in loc de copie + transformare)
+ */
+class CowMemoryBlock {
+private:
+    CowBuffer<int> buffer;
+
+public:
+    explicit CowMemoryBlock(size_t sz) : buffer(sz, 0) {
+        LOG_TRACE("[CowMemoryBlock] Alocare " << sz << " elemente");
+    }
+
+    CowMemoryBlock(const CowMemoryBlock& other) : buffer(other.buffer) {
+        LOG_TRACE("[CowMemoryBlock] Copy constructor - partajat (refCount=" << buffer.useCount() << ")");
+    }
+
+    CowMemoryBlock& operator=(const CowMemoryBlock& rhs) {
+        LOG_TRACE("[CowMemoryBlock] Copy assignment - partajat");
+        buffer = rhs.buffer;
+        return *this;
+    }
+
+    CowMemoryBlock(CowMemoryBlock&&) noexcept = default;
+    CowMemoryBlock& operator=(CowMemoryBlock&&) noexcept = default;
+
+    const int& operator[](size_t index) const { return buffer[index]; }
+
+    // Scrierea unui element (detach daca buffer-ul e partajat)
+    void set(size_t index, int value) {
+        if (buffer.isShared()) {
+            LOG_TRACE("[CowMemoryBlock] Prima scriere pe un buffer partajat - copie proprie");
+        }
+        buffer.set(index, value);
+    }
+
+    size_t getSize() const { return buffer.size(); }
+    const int* getData() const { return buffer.data(); }
+    // Dupa acest apel copiile blocului sunt deep copy (vezi CowBuffer)
+    int* mutableData() { return buffer.mutableData(); }
+    bool isShared() const { return buffer.isShared(); }
+    size_t useCount() const { return buffer.useCount(); }
+
+    void detach() { buffer.detach(); }
+
+    CowMemoryBlock make_unique_copy() const {
+        CowMemoryBlock copy(0);
+        copy.buffer = buffer.make_unique_copy();
+        return copy;
+    }
+
+    void fill(int value) {
+        buffer.rewrite([value](int* dst, const int*, size_t n) { simd::fill(dst, n, value); });
+    }
+
+    int64_t sum() const { return simd::sum(buffer.data(), buffer.size()); }
+
+    std::pair<int, int> minMax() const {
+        if (buffer.empty()) throw std::out_of_range("minMax pe un bloc gol");
+        return simd::minMax(buffer.data(), buffer.size());
+    }
+
+    void transformAffine(int mul, int add) {
+        buffer.rewrite([mul, add](int* dst, const int* src, size_t n) { simd::transformAffine(dst, src, n, mul, add); });
+    }
+};
+
+// ============================================================================
+// Exemplu 3: DatabaseConnection - RAII pentru conexiuni
+// ============================================================================
+class DatabaseConnection {
+private:
+    std::string connectionString;
+    bool connected;
+    int connectionId;
+    SimulatedDatabaseServer* server;   // nullptr: conexiune simulata local, fara latenta
+    uint64_t session;
+    static std::atomic<int> nextId;    // conexiunile se pot crea din mai multe thread-uri
+
+public:
+    explicit DatabaseConnection(const std::string& connStr, SimulatedDatabaseServer* srv = nullptr) 
+        : connectionString(connStr), connected(false),
+          connectionId(nextId.fetch_add(1, std::memory_order_relaxed)), server(srv), session(0) {
+        LOG_TRACE("[DB " << connectionId << "] Conectare la: " << connStr);
+        // Simulam conectarea (cu server: handshake-ul costa connectLatency)
+        if (server) {
+            session = server->connect();
+        }
+        connected = true;
+        LOG_TRACE("[DB " << connectionId << "] Conectat cu succes!");
+    }
+    
+    ~DatabaseConnection() {
+        if (connected) {
+            LOG_TRACE("[DB " << connectionId << "] Deconectare automata");
+            if (server) {
+                server->disconnect(session);
+            }
+            connected = false;
+        }
+    }
+    
+    // Item 14: Disable copying (conexiunea nu poate fi copiata)
+    DatabaseConnection(const DatabaseConnection&) = delete;
+    DatabaseConnection& operator=(const DatabaseConnection&) = delete;
+    
+    // Move semantics
+    DatabaseConnection(DatabaseConnection&& other) noexcept 
+        : connectionString(std::move(other.connectionString)), 
+          connected(other.connected), connectionId(other.connectionId),
+          server(other.server), session(other.session) {
+        other.connected = false;
+    }
+    
+    void executeQuery(const std::string& query) {
+        if (connected) {
+            LOG_DEBUG("[DB " << connectionId << "] Executare: " << query);
+            if (server) {
+                server->execute(session, query);
+            }
+        }
+    }
+
+    // --- Executie asincrona / pipelined ---
+    // Interogarea e trimisa imediat; rezultatul vine in future. Mai multe
+    // interogari trimise pe aceeasi conexiune sunt in zbor simultan.
+    std::future<std::string> executeAsync(std::string query) {
+        auto promise = std::make_shared<std::promise<std::string>>();
+        std::future<std::string> result = promise->get_future();
+        if (!connected) {
+            promise->set_exception(std::make_exception_ptr(std::runtime_error("Conexiunea este inchisa")));
+        } else if (!server) {
+            promise->set_value("OK: " + query);
+        } else {
+            // Serverul oprit arunca sincron (inainte sa retina callback-ul):
+            // eroarea ajunge tot prin future, ca celelalte, iar lotul continua
+            try {
+                server->executeAsync(session, std::move(query), [promise](std::string value, std::exception_ptr error) {
+                    if (error) {
+                        promise->set_exception(error);
+                    } else {
+                        promise->set_value(std::move(value));
+                    }
+                });
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        }
+        return result;
+    }
+
+    // Tot lotul pleaca fara sa astepte raspunsuri: costa ~un round-trip, nu N
+    std::vector<std::future<std::string>> executeBatch(const std::vector<std::string>& queries) {
+        LOG_DEBUG("[DB " << connectionId << "] Batch de " << queries.size() << " interogari");
+        std::vector<std::future<std::string>> results;
+        results.reserve(queries.size());
+        for (const std::string& query : queries) {
+            results.push_back(executeAsync(query));
+        }
+        return results;
+    }
+
+    // Interogarea e analizata o data; apoi se executa cu parametri diferiti
+    static PreparedStatement prepare(std::string sql) { return PreparedStatement(std::move(sql)); }
+
+    // Un numar gresit de parametri (std::invalid_argument din render) ajunge
+    // prin future, ca erorile serverului: intr-un lot, randurile deja trimise
+    // si cele de dupa raman valide
+    std::future<std::string> execute(const PreparedStatement& statement, const std::vector<std::string>& params) {
+        std::string query;
+        try {
+            query = statement.render(params);
+        } catch (...) {
+            std::promise<std::string> failed;
+            failed.set_exception(std::current_exception());
+            return failed.get_future();
+        }
+        return executeAsync(std::move(query));
+    }
+
+    std::vector<std::future<std::string>> executeBatch(const PreparedStatement& statement,
+                                                       const std::vector<std::vector<std::string>>& rows) {
+        LOG_DEBUG("[DB " << connectionId << "] Batch de " << rows.size() << " x " << statement.getSql());
+        std::vector<std::future<std::string>> results;
+        results.reserve(rows.size());
+        for (const std::vector<std::string>& params : rows) {
+            results.push_back(execute(statement, params));
+        }
+        return results;
+    }
+
+    // --- Executie cu corutine (C++20): std::string r = co_await db.query("...") ---
+    // Corutina e suspendata cat timp interogarea e in zbor; cand soseste
+    // raspunsul, e reluata pe AsyncExecutor-ul pe care rula (sau pe thread-ul
+    // dispatcher al serverului, daca nu rula pe un executor). Clasa nu depinde
+    // de <coroutine>: await_suspend primeste handle-ul ca parametru template,
+    // deci headerul ramane compilabil in C++17.
+    class QueryAwaiter {
+    private:
+        DatabaseConnection* connection;
+        std::string query;
+        std::string result;
+        std::exception_ptr error;
+
+    public:
+        QueryAwaiter(DatabaseConnection* c, std::string q) : connection(c), query(std::move(q)) {}
+
+        // Fara server (sau conexiune inchisa) rezultatul e disponibil imediat
+        bool await_ready() {
+            if (!connection->connected) {
+                error = std::make_exception_ptr(std::runtime_error("Conexiunea este inchisa"));
+                return true;
+            }
+            if (!connection->server) {
+                result = "OK: " + query;
+                return true;
+            }
+            return false;
+        }
+
+        template <typename CoroutineHandle>
+        void await_suspend(CoroutineHandle handle) {
+            AsyncExecutor* executor = AsyncExecutor::current();
+            // Dupa executeAsync, awaiter-ul poate fi deja distrus (corutina reluata
+            // pe alt thread): nu mai atingem membrii
+            connection->server->executeAsync(connection->session, std::move(query),
+                [this, handle, executor](std::string value, std::exception_ptr e) mutable {
+                    result = std::move(value);
+                    error = e;
+                    if (executor) {
+                        executor->post([handle]() mutable { handle.resume(); });
+                    } else {
+                        handle.resume();
+                    }
+                });
+        }
+
+        std::string await_resume() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return std::move(result);
+        }
+    };
+
+    QueryAwaiter query(std::string sql) { return QueryAwaiter(this, std::move(sql)); }
+
+    QueryAwaiter query(const PreparedStatement& statement, const std::vector<std::string>& params) {
+        return QueryAwaiter(this, statement.render(params));
+    }
+
+    // Health check pentru pool: un round-trip pana la server
+    bool ping() {
+        return connected && (!server || server->ping(session));
+    }
+    
+    bool isConnected() const { return connected; }
+    int getId() const { return connectionId; }
+};
+
+// Initializare static member
+inline std::atomic<int> DatabaseConnection::nextId{1};
+
+using DatabaseConnectionPool = ConnectionPool<DatabaseConnection>;
+
+// Pool de conexiuni catre server; ping() este health check-ul
+inline std::unique_ptr<DatabaseConnectionPool> makeDatabaseConnectionPool(
+    SimulatedDatabaseServer& server, const std::string& connStr, ConnectionPoolOptions options = {}) {
+    return std::make_unique<DatabaseConnectionPool>(
+        [&server, connStr]() { return std::make_unique<DatabaseConnection>(connStr, &server); },
+        [](DatabaseConnection& connection) { return connection.ping(); },
+        options);
+}
+
+// ============================================================================
+// Functii demonstrative pentru Item 13
+// ============================================================================
+inline void demonstrateRAII_FileHandle() {
+    std::cout << "\n--- RAII cu FileHandle ---\n" << std::endl;
+    
+    {
+        std::cout << "Intram in scope..." << std::endl;
+        FileHandle file("test_raii.txt", std::ios::out | std::ios::trunc);
+        
+        if (file.good()) {
+            file.write("Linia 1: RAII in actiune!\n");
+            file.write("Linia 2: Fisierul se va inchide automat.\n");
+            
+            // Calea rapida: buffer propriu de 1 MiB, mai multe bucati per apel, fara consola
+            file.setWriteBuffer(1 << 20);
+            file.writev({"Linia 3: ", "scriere bulk cu writev", "\n"});
+            file.flush();
+        }
+        
+        std::cout << "Iesim din scope..." << std::endl;
+    } // FileHandle destructor apelat automat aici!
+    
+    std::cout << "\nFisierul a fost inchis automat la iesirea din scope!\n" << std::endl;
+    
+    std::cout << "--- Citire zero-copy (memory-mapped) ---\n" << std::endl;
+    {
+        FileHandle file("test_raii.txt", std::ios::in);
+        
+        size_t lineNo = 0;
+        for (std::string_view line : file.mappedLines()) {
+            std::cout << "  [" << ++lineNo << "] " << line << std::endl;
+        }
+        std::cout << "Fisierul a fost citit prin mmap, fara copieri in std::string" << std::endl;
+    } // Maparea este eliberata odata cu FileHandle
+}
+
+inline void demonstrateRAII_MemoryBlock() {
+    std::cout << "\n--- RAII cu MemoryBlock ---\n" << std::endl;
+    
+    {
+        std::cout << "Intram in scope..." << std::endl;
+        MemoryBlock block(5);
+        
+        for (size_t i = 0; i < block.getSize(); ++i) {
+            block[i] = static_cast<int>(i * 10);
+        }
+        
+        std::cout << "Valori: ";
+        for (size_t i = 0; i < block.getSize(); ++i) {
+            std::cout << block[i] << " ";
+        }
+        std::cout << std::endl;
+
+        // Kernel-uri vectoriale (varianta aleasa la runtime dupa CPU)
+        auto [lo, hi] = block.minMax();
+        std::cout << "Suma: " << block.sum() << ", min: " << lo << ", max: " << hi
+                  << " (kernel-uri " << simd::isaName(simd::activeIsa()) << ")" << std::endl;
+        
+        std::cout << "Iesim din scope..." << std::endl;
+    } // MemoryBlock destructor apelat automat!
+    
+    std::cout << "\nMemoria a fost eliberata automat!\n" << std::endl;
+
+    // Buffere temporare pentru un lot: o singura Arena, fara malloc/free per buffer
+    std::cout << "Buffere temporare dintr-o Arena (3 loturi x 4 buffere):" << std::endl;
+    Arena scratch(4096);
+    for (int batch = 0; batch < 3; ++batch) {
+        long long checksum = 0;
+        for (int i = 0; i < 4; ++i) {
+            ArenaMemoryBlock<int> tmp(100, uninitialized, ArenaAllocator<int>(scratch));
+            for (size_t j = 0; j < tmp.getSize(); ++j) {
+                tmp[j] = static_cast<int>(j) * batch;
+            }
+            checksum += tmp[99];
+        }
+        std::cout << "  Lot " << batch << ": checksum " << checksum << ", " << scratch.bytesUsed()
+                  << " bytes din arena, " << scratch.chunkCount() << " chunk(uri)" << std::endl;
+        scratch.reset();
+    }
+    std::cout << "Arena refoloseste aceeasi memorie la fiecare lot\n" << std::endl;
+
+    // Copy-on-write: cititorii impart acelasi buffer, scriitorul isi face copia
+    std::cout << "Copy-on-write (CowMemoryBlock):" << std::endl;
+    {
+        CowMemoryBlock original(1000);
+        original.transformAffine(1, 7);
+        std::vector<CowMemoryBlock> readers(3, original);
+        std::cout << "  3 cititori, buffer partajat de " << original.useCount() << " obiecte, suma "
+                  << readers[0].sum() << std::endl;
+        readers[2].set(0, 1000);
+        std::cout << "  Dupa scriere in cititorul 3: partajat de " << original.useCount()
+                  << ", suma originalului " << original.sum() << ", a copiei " << readers[2].sum() << "\n" << std::endl;
+    }
+}
+
+inline void demonstrateRAII_ExceptionSafety() {
+    std::cout << "\n--- RAII: Exception Safety ---\n" << std::endl;
+    
+    try {
+        std::cout << "Intram in try block..." << std::endl;
+        MemoryBlock block(3);
+        DatabaseConnection db("localhost:5432/mydb");
+        
+        block[0] = 100;
+        db.executeQuery("SELECT * FROM users");
+        
+        std::cout << "Simulam o exceptie..." << std::endl;
+        throw std::runtime_error("Eroare simulata!");
+        
+        // Acest cod nu se executa
+        block[1] = 200;
+        
+    } catch (const std::exception& e) {
+        std::cout << "\nExceptie prinsa: " << e.what() << std::endl;
+        std::cout << "DAR resursele au fost eliberate automat de destructori!\n" << std::endl;
+    }
+}
+
+inline void demonstrateRAII_ConnectionPool() {
+    std::cout << "\n--- RAII: ConnectionPool cu lease-uri ---\n" << std::endl;
+
+    SimulatedDatabaseOptions serverOptions;
+    serverOptions.connectLatency = std::chrono::milliseconds(2);
+    serverOptions.roundTrip = std::chrono::microseconds(100);
+    SimulatedDatabaseServer server(serverOptions);
+
+    ConnectionPoolOptions poolOptions;
+    poolOptions.minSize = 2;
+    poolOptions.maxSize = 4;
+    auto pool = makeDatabaseConnectionPool(server, "localhost:5432/mydb", poolOptions);
+
+    // 6 thread-uri x 5 cereri, dar cel mult 4 conexiuni deschise
+    const int threads = 6;
+    const int requestsPerThread = 5;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&pool, t]() {
+            for (int i = 0; i < requestsPerThread; ++i) {
+                DatabaseConnectionPool::Lease db = pool->acquire();
+                db->executeQuery("SELECT * FROM orders WHERE worker = " + std::to_string(t));
+            } // lease distrus -> conexiunea revine in pool
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    ConnectionPoolStats stats = pool->stats();
+    std::cout << threads * requestsPerThread << " de cereri servite de " << stats.created << " conexiuni (maxim "
+              << poolOptions.maxSize << "), " << stats.waited << " asteptari" << std::endl;
+    std::cout << "Server: " << server.connectCount() << " handshake-uri, "
+              << server.queryCount() << " interogari" << std::endl;
+
+    // Pool plin: acquire cu timeout arunca exceptie in loc sa blocheze la nesfarsit
+    std::vector<DatabaseConnectionPool::Lease> held;
+    for (size_t i = 0; i < poolOptions.maxSize; ++i) {
+        held.push_back(pool->acquire());
+    }
+    try {
+        pool->acquire(std::chrono::milliseconds(20));
+    } catch (const std::exception& e) {
+        std::cout << "Pool epuizat: " << e.what() << std::endl;
+    }
+}
+
+inline void demonstrateRAII_QueryBatching() {
+    std::cout << "\n--- Interogari in lot (pipelining) si prepared statements ---\n" << std::endl;
+
+    SimulatedDatabaseOptions serverOptions;
+    serverOptions.roundTrip = std::chrono::milliseconds(1);
+    SimulatedDatabaseServer server(serverOptions);
+    DatabaseConnection db("localhost:5432/mydb", &server);
+
+    // Analizata o singura data, executata pentru fiecare rand
+    PreparedStatement insert = DatabaseConnection::prepare("INSERT INTO users VALUES (?, ?)");
+    auto results = db.executeBatch(insert, {{"1", "Ana"}, {"2", "Ion"}, {"3", "O'Brien"}});
+    for (auto& result : results) {
+        std::cout << "  " << result.get() << std::endl;
+    }
+
+    const int count = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        db.executeQuery("SELECT " + std::to_string(i));
+    }
+    auto sequential = std::chrono::steady_clock::now() - start;
+
+    std::vector<std::string> queries;
+    for (int i = 0; i < count; ++i) {
+        queries.push_back("SELECT " + std::to_string(i));
+    }
+    start = std::chrono::steady_clock::now();
+    for (auto& result : db.executeBatch(queries)) {
+        result.get();
+    }
+    auto batched = std::chrono::steady_clock::now() - start;
+
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    std::cout << count << " interogari, round-trip 1 ms: una cate una "
+              << duration_cast<milliseconds>(sequential).count() << " ms, in lot "
+              << duration_cast<milliseconds>(batched).count() << " ms" << std::endl;
+}
+
+inline void demonstrateItem13() {
+    std::cout << "\n";
+    std::cout << "============================================================\n";
+    std::cout << "  ITEM 13: Use objects to manage resources (RAII)\n";
+    std::cout << "============================================================\n";
+    
+    std::cout << "\nPrincipiul RAII:" << std::endl;
+    std::cout << "- Resursa este achizitionata in CONSTRUCTOR" << std::endl;
+    std::cout << "- Resursa este eliberata in DESTRUCTOR" << std::endl;
+    std::cout << "- Garanteaza eliberarea chiar si la exceptii!\n" << std::endl;
+    
+    demonstrateRAII_FileHandle();
+    demonstrateRAII_MemoryBlock();
+    demonstrateRAII_ExceptionSafety();
+    demonstrateRAII_ConnectionPool();
+    demonstrateRAII_QueryBatching();
+    
+    std::cout << "\n--- Avantajele RAII ---" << std::endl;
+    std::cout << "1. Nu poti uita sa eliberezi resursa" << std::endl;
+    std::cout << "2. Exception-safe: resursa e eliberata si la exceptii" << std::endl;
+    std::cout << "3. Cod mai curat, fara cleanup manual" << std::endl;
+    std::cout << "4. Ownership clar al resurselor\n" << std::endl;
+}
+
+#endif // RESOURCE_MANAGER_HPP
@@ -0,0 +1,313 @@
+#ifndef SIMD_KERNELS_HPP
+#define SIMD_KERNELS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define EFFECTIVECPP_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#else
+#define EFFECTIVECPP_SIMD_X86 0
+#endif
+
+// GCC/Clang: functiile AVX2 sunt compilate cu target("avx2"), restul
+// programului ramane compilat pentru setul de baza. MSVC accepta
+// intrinsecile AVX2 fara flag-uri speciale.
+#if EFFECTIVECPP_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define EFFECTIVECPP_TARGET_SSE2 __attribute__((target("sse2")))
+#define EFFECTIVECPP_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define EFFECTIVECPP_TARGET_SSE2
+#define EFFECTIVECPP_TARGET_AVX2
+#endif
+
+/**
+ * ============================================================================
+ * Kernel-uri SIMD pentru buffere de int32 (MemoryBlock)
+ * ============================================================================
+ *
+ * - fill, sum, minMax, transformAffine (dst = src * mul + add)
+ * - Implementarea (Scalar / SSE2 / AVX2) se alege o singura data, la runtime,
+ *   dupa CPU-ul pe care ruleaza programul (__builtin_cpu_supports / cpuid)
+ * - copy() foloseste memcpy: biblioteca C are deja variante vectorizate,
+ *   alese tot la runtime
+ * - useIsa() permite fortarea unei variante mai slabe (pentru benchmark-uri)
+ *
+ * Suma se acumuleaza pe 64 de biti (fara overflow); transformAffine are
+ * aritmetica modulo 2^32, ca instructiunile SIMD.
+ */
+namespace simd {
+
+enum class Isa { Scalar, SSE2, AVX2 };
+
+inline const char* isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2: return "AVX2";
+        case Isa::SSE2: return "SSE2";
+        default:        return "Scalar";
+    }
+}
+
+// Cel mai bun set de instructiuni suportat de CPU (si de sistemul de operare)
+inline Isa detectIsa() {
+#if EFFECTIVECPP_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+    if (__builtin_cpu_supports("sse2")) return Isa::SSE2;
+    return Isa::Scalar;
+#elif EFFECTIVECPP_SIMD_X86 && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0;
+    if (avx2 && osxsave && (_xgetbv(0) & 0x6) == 0x6) return Isa::AVX2;
+    return sse2 ? Isa::SSE2 : Isa::Scalar;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+namespace detail {
+
+// ============================================================================
+// Scalar (referinta si coada buclelor vectoriale)
+// ============================================================================
+inline void fillScalar(int32_t* dst, size_t n, int32_t value) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = value;
+    }
+}
+
+inline int64_t sumScalar(const int32_t* p, size_t n) {
+    int64_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        total += p[i];
+    }
+    return total;
+}
+
+inline void minMaxScalar(const int32_t* p, size_t n, int32_t* outMin, int32_t* outMax) {
+    int32_t lo = *outMin;
+    int32_t hi = *outMax;
+    for (size_t i = 0; i < n; ++i) {
+        lo = p[i] < lo ? p[i] : lo;
+        hi = p[i] > hi ? p[i] : hi;
+    }
+    *outMin = lo;
+    *outMax = hi;
+}
+
+inline void affineScalar(int32_t* dst, const int32_t* src, size_t n, int32_t mul, int32_t add) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<int32_t>(static_cast<uint32_t>(src[i]) * static_cast<uint32_t>(mul) +
+                                      static_cast<uint32_t>(add));
+    }
+}
+
+#if EFFECTIVECPP_SIMD_X86
+// ============================================================================
+// SSE2 (4 x int32)
+// ============================================================================
+EFFECTIVECPP_TARGET_SSE2 inline void fillSse2(int32_t* dst, size_t n, int32_t value) {
+    const __m128i v = _mm_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+    fillScalar(dst + i, n - i, value);
+}
+
+EFFECTIVECPP_TARGET_SSE2 inline int64_t sumSse2(const int32_t* p, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i sign = _mm_srai_epi32(v, 31);   // extindere cu semn la 64 de biti
+        acc = _mm_add_epi64(acc, _mm_add_epi64(_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)));
+    }
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + sumScalar(p + i, n - i);
+}
+
+EFFECTIVECPP_TARGET_SSE2 inline void minMaxSse2(const int32_t* p, size_t n, int32_t* outMin, int32_t* outMax) {
+    // SSE2 nu are min/max pe int32 (apar in SSE4.1): comparatie + selectie pe biti
+    __m128i vmin = _mm_set1_epi32(*outMin);
+    __m128i vmax = _mm_set1_epi32(*outMax);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i less = _mm_cmpgt_epi32(vmin, v);
+        vmin = _mm_or_si128(_mm_and_si128(less, v), _mm_andnot_si128(less, vmin));
+        __m128i greater = _mm_cmpgt_epi32(v, vmax);
+        vmax = _mm_or_si128(_mm_and_si128(greater, v), _mm_andnot_si128(greater, vmax));
+    }
+    alignas(16) int32_t lo[4];
+    alignas(16) int32_t hi[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lo), vmin);
+    _mm_store_si128(reinterpret_cast<__m128i*>(hi), vmax);
+    minMaxScalar(lo, 4, outMin, outMax);
+    minMaxScalar(hi, 4, outMin, outMax);
+    minMaxScalar(p + i, n - i, outMin, outMax);
+}
+
+// Inmultire int32 x int32 -> 32 de biti inferiori (_mm_mullo_epi32 e SSE4.1)
+EFFECTIVECPP_TARGET_SSE2 inline __m128i mulloSse2(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+EFFECTIVECPP_TARGET_SSE2 inline void affineSse2(int32_t* dst, const int32_t* src, size_t n, int32_t mul, int32_t add) {
+    const __m128i vmul = _mm_set1_epi32(mul);
+    const __m128i vadd = _mm_set1_epi32(add);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(mulloSse2(v, vmul), vadd));
+    }
+    affineScalar(dst + i, src + i, n - i, mul, add);
+}
+
+// ============================================================================
+// AVX2 (8 x int32)
+// ============================================================================
+EFFECTIVECPP_TARGET_AVX2 inline void fillAvx2(int32_t* dst, size_t n, int32_t value) {
+    const __m256i v = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+    }
+    fillScalar(dst + i, n - i, value);
+}
+
+EFFECTIVECPP_TARGET_AVX2 inline int64_t sumAvx2(const int32_t* p, size_t n) {
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sumScalar(p + i, n - i);
+}
+
+EFFECTIVECPP_TARGET_AVX2 inline void minMaxAvx2(const int32_t* p, size_t n, int32_t* outMin, int32_t* outMax) {
+    __m256i vmin = _mm256_set1_epi32(*outMin);
+    __m256i vmax = _mm256_set1_epi32(*outMax);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        vmin = _mm256_min_epi32(vmin, v);
+        vmax = _mm256_max_epi32(vmax, v);
+    }
+    alignas(32) int32_t lo[8];
+    alignas(32) int32_t hi[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lo), vmin);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(hi), vmax);
+    minMaxScalar(lo, 8, outMin, outMax);
+    minMaxScalar(hi, 8, outMin, outMax);
+    minMaxScalar(p + i, n - i, outMin, outMax);
+}
+
+EFFECTIVECPP_TARGET_AVX2 inline void affineAvx2(int32_t* dst, const int32_t* src, size_t n, int32_t mul, int32_t add) {
+    const __m256i vmul = _mm256_set1_epi32(mul);
+    const __m256i vadd = _mm256_set1_epi32(add);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(_mm256_mullo_epi32(v, vmul), vadd));
+    }
+    affineScalar(dst + i, src + i, n - i, mul, add);
+}
+#endif // EFFECTIVECPP_SIMD_X86
+
+// Tabela de functii pentru o varianta; se alege o data si apoi e doar un apel indirect
+struct Kernels {
+    Isa isa;
+    void (*fill)(int32_t*, size_t, int32_t);
+    int64_t (*sum)(const int32_t*, size_t);
+    void (*minMax)(const int32_t*, size_t, int32_t*, int32_t*);
+    void (*affine)(int32_t*, const int32_t*, size_t, int32_t, int32_t);
+};
+
+inline const Kernels* kernelsFor(Isa isa) {
+    static const Kernels scalar{Isa::Scalar, fillScalar, sumScalar, minMaxScalar, affineScalar};
+#if EFFECTIVECPP_SIMD_X86
+    static const Kernels sse2{Isa::SSE2, fillSse2, sumSse2, minMaxSse2, affineSse2};
+    static const Kernels avx2{Isa::AVX2, fillAvx2, sumAvx2, minMaxAvx2, affineAvx2};
+    switch (isa) {
+        case Isa::AVX2: return &avx2;
+        case Isa::SSE2: return &sse2;
+        default:        return &scalar;
+    }
+#else
+    (void)isa;
+    return &scalar;
+#endif
+}
+
+inline std::atomic<const Kernels*> activeKernels{nullptr};
+
+inline const Kernels& kernels() {
+    const Kernels* k = activeKernels.load(std::memory_order_acquire);
+    if (!k) {
+        k = kernelsFor(detectIsa());
+        activeKernels.store(k, std::memory_order_release);
+    }
+    return *k;
+}
+
+} // namespace detail
+
+inline Isa activeIsa() { return detail::kernels().isa; }
+
+// Forteaza o varianta (limitata la ce suporta CPU-ul); intoarce varianta folosita efectiv
+inline Isa useIsa(Isa requested) {
+    Isa best = detectIsa();
+    Isa chosen = static_cast<int>(requested) < static_cast<int>(best) ? requested : best;
+    detail::activeKernels.store(detail::kernelsFor(chosen), std::memory_order_release);
+    return chosen;
+}
+
+inline void fill(int32_t* dst, size_t n, int32_t value) { detail::kernels().fill(dst, n, value); }
+
+inline int64_t sum(const int32_t* p, size_t n) { return detail::kernels().sum(p, n); }
+
+// n trebuie sa fie > 0
+inline std::pair<int32_t, int32_t> minMax(const int32_t* p, size_t n) {
+    int32_t lo = p[0];
+    int32_t hi = p[0];
+    detail::kernels().minMax(p + 1, n - 1, &lo, &hi);
+    return {lo, hi};
+}
+
+inline void transformAffine(int32_t* dst, const int32_t* src, size_t n, int32_t mul, int32_t add) {
+    detail::kernels().affine(dst, src, n, mul, add);
+}
+
+template <typename T>
+inline void copy(T* dst, const T* src, size_t n) {
+    static_assert(std::is_trivially_copyable<T>::value, "simd::copy cere tipuri trivial copiabile");
+    if (n) {
+        std::memcpy(dst, src, n * sizeof(T));
+    }
+}
+
+} // namespace simd
+
+#endif // SIMD_KERNELS_HPP
@@ -0,0 +1,215 @@
+#ifndef SIMULATED_DATABASE_HPP
+#define SIMULATED_DATABASE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * ============================================================================
+ * SimulatedDatabaseServer: backend de baza de date simulat, in proces
+ * ============================================================================
+ *
+ * Inlocuieste un server real in demo-uri si benchmark-uri. Costurile retelei
+ * sunt simulate cu sleep:
+ * - connect():  handshake TCP + TLS + autentificare (implicit 2 ms)
+ * - execute() / ping(): un round-trip (implicit 100 us)
+ *
+ * killSession()/killAllSessions() simuleaza o conexiune cazuta sau un restart
+ * al serverului: sesiunile afectate raspund cu eroare, iar ping() intoarce false.
+ *
+ * executeAsync() simuleaza pipelining-ul: cererea "pleaca" imediat, iar
+ * raspunsul soseste dupa un round-trip, fara sa blocheze apelantul. Mai multe
+ * cereri trimise una dupa alta sunt in zbor simultan, deci N cereri costa
+ * aproximativ un singur round-trip, nu N. Raspunsurile sunt livrate, in ordinea
+ * trimiterii, de un thread dispatcher (pornit la prima cerere asincrona) care
+ * apeleaza callback-ul primit.
+ */
+struct SimulatedDatabaseOptions {
+    std::chrono::microseconds connectLatency{2000};
+    std::chrono::microseconds roundTrip{100};
+};
+
+class SimulatedDatabaseServer {
+public:
+    using Clock = std::chrono::steady_clock;
+    // Rezultatul sau exceptia (exact unul dintre ele e setat)
+    using Completion = std::function<void(std::string result, std::exception_ptr error)>;
+
+private:
+    struct PendingQuery {
+        Clock::time_point due;
+        uint64_t sequence;
+        uint64_t session;
+        std::string query;
+        Completion done;
+    };
+
+    // Min-heap dupa momentul sosirii raspunsului; la egalitate, ordinea trimiterii
+    struct ArrivesLater {
+        bool operator()(const PendingQuery& a, const PendingQuery& b) const {
+            return a.due != b.due ? a.due > b.due : a.sequence > b.sequence;
+        }
+    };
+
+    SimulatedDatabaseOptions options;
+    mutable std::mutex sessionsMutex;
+    std::unordered_set<uint64_t> sessions;
+    std::atomic<uint64_t> nextSession{1};
+    std::atomic<uint64_t> connects{0};
+    std::atomic<uint64_t> queries{0};
+
+    std::mutex dispatchMutex;
+    std::condition_variable dispatchCv;
+    std::vector<PendingQuery> inFlight;   // heap (ArrivesLater)
+    uint64_t nextSequence = 0;
+    bool stopping = false;
+    std::thread dispatcher;
+
+    bool isAlive(uint64_t session) const {
+        std::lock_guard<std::mutex> lock(sessionsMutex);
+        return sessions.count(session) != 0;
+    }
+
+    void complete(PendingQuery& pending, bool shuttingDown) {
+        if (shuttingDown) {
+            pending.done({}, std::make_exception_ptr(std::runtime_error("Serverul a fost oprit")));
+        } else if (!isAlive(pending.session)) {
+            pending.done({}, std::make_exception_ptr(std::runtime_error(
+                "Sesiunea " + std::to_string(pending.session) + " a fost inchisa de server")));
+        } else {
+            queries.fetch_add(1, std::memory_order_relaxed);
+            pending.done("OK: " + pending.query, nullptr);
+        }
+    }
+
+    void dispatchLoop() {
+        std::unique_lock<std::mutex> lock(dispatchMutex);
+        std::vector<PendingQuery> ready;
+        for (;;) {
+            if (inFlight.empty()) {
+                if (stopping) {
+                    return;
+                }
+                dispatchCv.wait(lock);
+                continue;
+            }
+            Clock::time_point now = Clock::now();
+            if (!stopping && now < inFlight.front().due) {
+                dispatchCv.wait_until(lock, inFlight.front().due);
+                continue;
+            }
+            // Toate raspunsurile sosite pana acum, livrate fara lock
+            while (!inFlight.empty() && (stopping || inFlight.front().due <= now)) {
+                std::pop_heap(inFlight.begin(), inFlight.end(), ArrivesLater());
+                ready.push_back(std::move(inFlight.back()));
+                inFlight.pop_back();
+            }
+            bool shuttingDown = stopping;
+            lock.unlock();
+            for (PendingQuery& pending : ready) {
+                complete(pending, shuttingDown);
+            }
+            ready.clear();
+            lock.lock();
+        }
+    }
+
+public:
+    explicit SimulatedDatabaseServer(SimulatedDatabaseOptions opts = {}) : options(opts) {}
+
+    // Cererile inca in zbor primesc eroare ("Serverul a fost oprit")
+    ~SimulatedDatabaseServer() {
+        {
+            std::lock_guard<std::mutex> lock(dispatchMutex);
+            stopping = true;
+        }
+        dispatchCv.notify_one();
+        if (dispatcher.joinable()) {
+            dispatcher.join();
+        }
+    }
+
+    SimulatedDatabaseServer(const SimulatedDatabaseServer&) = delete;
+    SimulatedDatabaseServer& operator=(const SimulatedDatabaseServer&) = delete;
+
+    // Deschide o sesiune noua; dureaza connectLatency
+    uint64_t connect() {
+        std::this_thread::sleep_for(options.connectLatency);
+        uint64_t session = nextSession.fetch_add(1, std::memory_order_relaxed);
+        connects.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(sessionsMutex);
+        sessions.insert(session);
+        return session;
+    }
+
+    void disconnect(uint64_t session) {
+        std::lock_guard<std::mutex> lock(sessionsMutex);
+        sessions.erase(session);
+    }
+
+    // Health check: un round-trip; false daca sesiunea nu mai exista
+    bool ping(uint64_t session) {
+        std::this_thread::sleep_for(options.roundTrip);
+        return isAlive(session);
+    }
+
+    // Executa o interogare: un round-trip; arunca std::runtime_error pe o sesiune cazuta
+    std::string execute(uint64_t session, const std::string& query) {
+        std::this_thread::sleep_for(options.roundTrip);
+        if (!isAlive(session)) {
+            throw std::runtime_error("Sesiunea " + std::to_string(session) + " a fost inchisa de server");
+        }
+        queries.fetch_add(1, std::memory_order_relaxed);
+        return "OK: " + query;
+    }
+
+    // Trimite interogarea si revine imediat; done() e apelat pe thread-ul
+    // dispatcher dupa un round-trip
+    void executeAsync(uint64_t session, std::string query, Completion done) {
+        std::lock_guard<std::mutex> lock(dispatchMutex);
+        if (stopping) {
+            throw std::runtime_error("Serverul a fost oprit");
+        }
+        if (!dispatcher.joinable()) {
+            dispatcher = std::thread(&SimulatedDatabaseServer::dispatchLoop, this);
+        }
+        Clock::time_point due = Clock::now() + options.roundTrip;
+        bool wake = inFlight.empty() || due < inFlight.front().due;
+        inFlight.push_back({due, nextSequence++, session, std::move(query), std::move(done)});
+        std::push_heap(inFlight.begin(), inFlight.end(), ArrivesLater());
+        // Dispatcher-ul doarme pana la primul raspuns; il trezim doar daca acesta s-a schimbat
+        if (wake) {
+            dispatchCv.notify_one();
+        }
+    }
+
+    void killSession(uint64_t session) { disconnect(session); }
+
+    void killAllSessions() {
+        std::lock_guard<std::mutex> lock(sessionsMutex);
+        sessions.clear();
+    }
+
+    const SimulatedDatabaseOptions& getOptions() const { return options; }
+    uint64_t connectCount() const { return connects.load(std::memory_order_relaxed); }
+    uint64_t queryCount() const { return queries.load(std::memory_order_relaxed); }
+
+    size_t activeSessions() const {
+        std::lock_guard<std::mutex> lock(sessionsMutex);
+        return sessions.size();
+    }
+};
+
+#endif // SIMULATED_DATABASE_HPP
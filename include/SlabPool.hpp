@@ -0,0 +1,244 @@
+#ifndef SLAB_POOL_HPP
+#define SLAB_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * ============================================================================
+ * SlabPool<T>: alocator de obiecte de dimensiune fixa, per tip
+ * ============================================================================
+ *
+ * - Memoria vine in slab-uri mari (64 KiB), taiate in blocuri de sizeof(T)
+ * - Fiecare thread are un cache local (lista de blocuri libere) - alocarea si
+ *   eliberarea obisnuita nu iau niciun lock
+ * - Cand cache-ul local e gol, ia un lot de blocuri din lista globala (sub
+ *   mutex); cand are prea multe, returneaza un lot. La iesirea thread-ului,
+ *   cache-ul se goleste in lista globala
+ * - Dupa distrugerea cache-ului (obiecte eliberate din destructorii altor
+ *   thread_local sau din atexit), alocarile si eliberarile merg direct in
+ *   lista globala, sub mutex
+ * - Slab-urile nu se elibereaza catre sistem (pool-ul traieste cat procesul)
+ *
+ * Clasele il folosesc prin operator new/delete la nivel de clasa:
+ *     void* Person::operator new(size_t size) { return SlabPool<Person>::allocate(size); }
+ *
+ * Statisticile sunt agregate la fiecare transfer cache <-> global, deci pot
+ * ramane in urma cu cel mult un lot per thread.
+ */
+
+struct SlabPoolStats {
+    size_t blockSize = 0;
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t slabs = 0;
+    uint64_t bytesReserved = 0;
+    uint64_t globalRefills = 0;   // loturi luate din lista globala
+    uint64_t globalReturns = 0;   // loturi returnate in lista globala
+    uint64_t fallbacks = 0;       // cereri de alta dimensiune (clase derivate) -> ::operator new
+};
+
+template <typename T>
+class SlabPool {
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    static constexpr size_t kAlign = alignof(T) > alignof(FreeNode) ? alignof(T) : alignof(FreeNode);
+    static constexpr size_t kBlockSize =
+        ((sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode)) + kAlign - 1) / kAlign * kAlign;
+    static constexpr size_t kSlabBytes = 64 * 1024;
+    static constexpr size_t kBlocksPerSlab = kSlabBytes / kBlockSize > 0 ? kSlabBytes / kBlockSize : 1;
+    static constexpr size_t kBatch = 64;   // blocuri mutate o data intre cache si global
+
+    // Starea comuna tuturor thread-urilor (protejata de mutex)
+    struct Global {
+        std::mutex mutex;
+        FreeNode* freeList = nullptr;
+        size_t freeCount = 0;
+        std::vector<void*> slabs;
+        SlabPoolStats stats;
+    };
+
+    // Nu se distruge niciodata: thread-urile care ies dupa main inca o folosesc
+    static Global& global() {
+        static Global* instance = new Global();
+        return *instance;
+    }
+
+    struct ThreadCache {
+        FreeNode* head = nullptr;
+        size_t count = 0;
+        uint64_t allocations = 0;
+        uint64_t deallocations = 0;
+
+        ~ThreadCache() {
+            cacheGone() = true;
+            Global& g = global();
+            std::lock_guard<std::mutex> lock(g.mutex);
+            flushStats(g);
+            while (head) {
+                FreeNode* node = head;
+                head = head->next;
+                node->next = g.freeList;
+                g.freeList = node;
+                ++g.freeCount;
+            }
+            count = 0;
+        }
+
+        void flushStats(Global& g) {
+            g.stats.allocations += allocations;
+            g.stats.deallocations += deallocations;
+            allocations = 0;
+            deallocations = 0;
+        }
+    };
+
+    static ThreadCache& cache() {
+        thread_local ThreadCache instance;
+        return instance;
+    }
+
+    // Setat de ~ThreadCache. Un bool thread_local nu are destructor, deci
+    // ramane valid si dupa ce cache-ul thread-ului a fost distrus
+    static bool& cacheGone() {
+        thread_local bool gone = false;
+        return gone;
+    }
+
+    // Apelat cu mutex-ul global luat
+    static void carveSlab(Global& g) {
+        char* slab = static_cast<char*>(::operator new(kBlocksPerSlab * kBlockSize, std::align_val_t(kAlign)));
+        g.slabs.push_back(slab);
+        for (size_t i = 0; i < kBlocksPerSlab; ++i) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(slab + i * kBlockSize);
+            node->next = g.freeList;
+            g.freeList = node;
+        }
+        g.freeCount += kBlocksPerSlab;
+        ++g.stats.slabs;
+        g.stats.bytesReserved += kBlocksPerSlab * kBlockSize;
+    }
+
+    static void refill(ThreadCache& local) {
+        Global& g = global();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        if (g.freeCount < kBatch) {
+            carveSlab(g);
+        }
+        for (size_t i = 0; i < kBatch && g.freeList; ++i) {
+            FreeNode* node = g.freeList;
+            g.freeList = node->next;
+            --g.freeCount;
+            node->next = local.head;
+            local.head = node;
+            ++local.count;
+        }
+        ++g.stats.globalRefills;
+        local.flushStats(g);
+    }
+
+    static void spill(ThreadCache& local) {
+        Global& g = global();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        for (size_t i = 0; i < kBatch && local.head; ++i) {
+            FreeNode* node = local.head;
+            local.head = node->next;
+            --local.count;
+            node->next = g.freeList;
+            g.freeList = node;
+            ++g.freeCount;
+        }
+        ++g.stats.globalReturns;
+        local.flushStats(g);
+    }
+
+    // Cale lenta pentru thread-urile al caror cache a fost distrus
+    static void* allocateGlobal() {
+        Global& g = global();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        if (!g.freeList) {
+            carveSlab(g);
+        }
+        FreeNode* node = g.freeList;
+        g.freeList = node->next;
+        --g.freeCount;
+        ++g.stats.allocations;
+        return node;
+    }
+
+    static void deallocateGlobal(FreeNode* node) {
+        Global& g = global();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        node->next = g.freeList;
+        g.freeList = node;
+        ++g.freeCount;
+        ++g.stats.deallocations;
+    }
+
+    static void countFallback() {
+        Global& g = global();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        ++g.stats.fallbacks;
+    }
+
+public:
+    // size != sizeof(T): cerere venita de la o clasa derivata fara operator new propriu
+    static void* allocate(size_t size) {
+        if (size != sizeof(T)) {
+            countFallback();
+            return ::operator new(size);
+        }
+        if (cacheGone()) {
+            return allocateGlobal();
+        }
+        ThreadCache& local = cache();
+        if (!local.head) {
+            refill(local);
+        }
+        FreeNode* node = local.head;
+        local.head = node->next;
+        --local.count;
+        ++local.allocations;
+        return node;
+    }
+
+    static void deallocate(void* p, size_t size) noexcept {
+        if (!p) {
+            return;
+        }
+        if (size != sizeof(T)) {
+            ::operator delete(p);
+            return;
+        }
+        if (cacheGone()) {
+            deallocateGlobal(static_cast<FreeNode*>(p));
+            return;
+        }
+        ThreadCache& local = cache();
+        FreeNode* node = static_cast<FreeNode*>(p);
+        node->next = local.head;
+        local.head = node;
+        ++local.count;
+        ++local.deallocations;
+        if (local.count > 2 * kBatch) {
+            spill(local);
+        }
+    }
+
+    static SlabPoolStats stats() {
+        Global& g = global();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        SlabPoolStats result = g.stats;
+        result.blockSize = kBlockSize;
+        return result;
+    }
+};
+
+#endif // SLAB_POOL_HPP
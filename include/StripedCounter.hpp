@@ -0,0 +1,83 @@
+#ifndef STRIPED_COUNTER_HPP
+#define STRIPED_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+/**
+ * ============================================================================
+ * StripedCounter: contor impartit pe mai multe slot-uri (sharding)
+ * ============================================================================
+ *
+ * Un singur std::atomic incrementat de multe core-uri face ca linia de cache
+ * sa "sara" intre ele la fiecare incrementare. Aici fiecare thread scrie in
+ * propriul slot (aliniat la 64 bytes, deci fara false sharing), cu
+ * incrementari relaxed. Citirea aduna toate slot-urile.
+ *
+ * - Valorile sunt pe 64 de biti (nu mai exista overflow la int)
+ * - load() nu este un snapshot atomic: in timpul incrementarilor concurente
+ *   poate intoarce orice valoare intre cea de dinainte si cea de dupa
+ */
+
+// Index stabil per thread: thread-urile primesc slot-uri consecutive (round-robin)
+inline size_t currentThreadSlot() {
+    static std::atomic<size_t> nextSlot(0);
+    thread_local size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+class StripedCounter {
+private:
+    static constexpr size_t kCacheLine = 64;
+
+    struct alignas(kCacheLine) Slot {
+        std::atomic<uint64_t> value{0};
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+
+    static size_t defaultStripes() {
+        size_t hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 8 : hw;
+    }
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+public:
+    explicit StripedCounter(size_t stripes = defaultStripes())
+        : slots(new Slot[roundUpPow2(stripes)]), mask(roundUpPow2(stripes) - 1) {}
+
+    StripedCounter(const StripedCounter&) = delete;
+    StripedCounter& operator=(const StripedCounter&) = delete;
+
+    void increment(uint64_t delta = 1) {
+        slots[currentThreadSlot() & mask].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    // Suma tuturor slot-urilor
+    uint64_t load() const {
+        uint64_t total = 0;
+        for (size_t i = 0; i <= mask; ++i) {
+            total += slots[i].value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() {
+        for (size_t i = 0; i <= mask; ++i) {
+            slots[i].value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    size_t stripes() const { return mask + 1; }
+};
+
+#endif // STRIPED_COUNTER_HPP
@@ -0,0 +1,186 @@
+#ifndef TASK_HPP
+#define TASK_HPP
+
+/**
+ * ============================================================================
+ * Task<T>: corutina C++20 care intoarce o valoare (folosita cu co_await)
+ * ============================================================================
+ *
+ *     Task<std::string> handleRequest(DatabaseConnection& db, int id) {
+ *         co_await scheduleOn(executor);
+ *         std::string user = co_await db.query("SELECT ... " + std::to_string(id));
+ *         co_return user;
+ *     }
+ *
+ *     std::future<std::string> f = spawn(executor, handleRequest(db, 7));
+ *
+ * - Task e "lazy": corpul porneste abia cand cineva face co_await pe el
+ * - La final, controlul trece direct la corutina care astepta (symmetric
+ *   transfer), fara recursie pe stiva
+ * - spawn() porneste un Task pe un AsyncExecutor si ofera rezultatul ca future
+ *
+ * Disponibil doar cand compilatorul are corutine (C++20); proiectul principal
+ * ramane C++17, iar EFFECTIVECPP_HAS_COROUTINES spune daca headerul e activ.
+ */
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define EFFECTIVECPP_HAS_COROUTINES 1
+#endif
+#endif
+
+#ifndef EFFECTIVECPP_HAS_COROUTINES
+#define EFFECTIVECPP_HAS_COROUTINES 0
+#endif
+
+#if EFFECTIVECPP_HAS_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "AsyncExecutor.hpp"
+
+template <typename T>
+class Task {
+    static_assert(!std::is_void_v<T>, "Task<void> nu este suportat; intoarceti o valoare");
+
+public:
+    struct promise_type {
+        std::optional<T> value;
+        std::exception_ptr error;
+        std::coroutine_handle<> continuation;
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) noexcept {
+                std::coroutine_handle<> next = self.promise().continuation;
+                return next ? next : std::noop_coroutine();
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        template <typename U>
+        void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+public:
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle) {
+                handle.destroy();
+            }
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    // co_await task: porneste corutina si reia apelantul cand aceasta se termina
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() {
+                promise_type& p = handle.promise();
+                if (p.error) {
+                    std::rethrow_exception(p.error);
+                }
+                return std::move(*p.value);
+            }
+        };
+        return Awaiter{handle};
+    }
+};
+
+// co_await scheduleOn(executor): continua corutina pe un thread al executorului
+inline auto scheduleOn(AsyncExecutor& executor) {
+    struct Awaiter {
+        AsyncExecutor& executor;
+
+        bool await_ready() noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            executor.post([handle]() { handle.resume(); });
+        }
+
+        void await_resume() noexcept {}
+    };
+    return Awaiter{executor};
+}
+
+namespace detail {
+
+// Corutina "fire and forget": se distruge singura la final
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+template <typename T>
+DetachedTask runDetached(AsyncExecutor& executor, Task<T> task, std::shared_ptr<std::promise<T>> result) {
+    co_await scheduleOn(executor);
+    try {
+        result->set_value(co_await std::move(task));
+    } catch (...) {
+        result->set_exception(std::current_exception());
+    }
+}
+
+} // namespace detail
+
+// Porneste task-ul pe executor; rezultatul (sau exceptia) ajunge in future
+template <typename T>
+std::future<T> spawn(AsyncExecutor& executor, Task<T> task) {
+    auto result = std::make_shared<std::promise<T>>();
+    std::future<T> future = result->get_future();
+    detail::runDetached(executor, std::move(task), result);
+    return future;
+}
+
+#endif // EFFECTIVECPP_HAS_COROUTINES
+
+#endif // TASK_HPP
@@ -0,0 +1,293 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * ============================================================================
+ * ThreadPool: pool de thread-uri cu work stealing
+ * ============================================================================
+ *
+ * - Fiecare worker are propriul deque (cu mutex propriu, deci fara un lock
+ *   global pe calea fierbinte)
+ * - submit() de pe un worker pune task-ul in deque-ul propriu (cache cald);
+ *   din afara pool-ului, task-urile sunt distribuite round-robin
+ * - Un worker ia intai din spatele propriului deque (LIFO), apoi "fura" din
+ *   fata deque-urilor celorlalti (FIFO - cele mai vechi task-uri)
+ * - Worker-ii fara treaba dorm pe un condition_variable; submit() ii trezeste
+ *   doar daca exista cineva care doarme
+ * - shutdown() (si destructorul) termina toate task-urile deja trimise,
+ *   apoi opreste thread-urile; submit() dupa shutdown arunca exceptie
+ *
+ * Task-urile care blocheaza (asteapta I/O, alte thread-uri) ocupa un worker
+ * cat timp blocheaza - pool-ul trebuie sa aiba destule thread-uri pentru ele.
+ */
+class ThreadPool {
+private:
+    using Task = std::function<void()>;
+
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<size_t> pending{0};    // task-uri puse in cozi, inca neluate
+    std::atomic<size_t> sleepers{0};
+    std::atomic<size_t> nextWorker{0};
+    std::atomic<bool> stopping{false};
+
+    struct WorkerIdentity {
+        const ThreadPool* pool = nullptr;
+        size_t index = 0;
+    };
+
+    static WorkerIdentity& identity() {
+        thread_local WorkerIdentity id;
+        return id;
+    }
+
+    void enqueue(Task task) {
+        const WorkerIdentity& id = identity();
+        // Task-urile care ruleaza in timpul shutdown-ului pot trimite sub-task-uri
+        if (id.pool != this && stopping.load(std::memory_order_acquire)) {
+            throw std::runtime_error("ThreadPool: submit dupa shutdown");
+        }
+        size_t target = id.pool == this ? id.index
+                                        : nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+        // Incrementam inainte de push: pending nu scade niciodata sub zero
+        pending.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(workers[target]->mutex);
+            workers[target]->tasks.push_back(std::move(task));
+        }
+        // seq_cst: fie submit vede un worker care doarme, fie worker-ul vede task-ul
+        if (sleepers.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            wake.notify_one();
+        }
+    }
+
+    bool popLocal(size_t index, Task& out) {
+        Worker& w = *workers[index];
+        std::lock_guard<std::mutex> lock(w.mutex);
+        if (w.tasks.empty()) {
+            return false;
+        }
+        out = std::move(w.tasks.back());
+        w.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, Task& out) {
+        for (size_t i = 1; i < workers.size(); ++i) {
+            Worker& victim = *workers[(thief + i) % workers.size()];
+            std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+            if (lock && !victim.tasks.empty()) {
+                out = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool findTask(size_t index, Task& out) {
+        if (popLocal(index, out) || steal(index, out)) {
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(size_t index) {
+        identity() = WorkerIdentity{this, index};
+        Task task;
+        for (;;) {
+            if (findTask(index, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            // try_to_lock in steal() poate rata un task: verificam din nou sub lock
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            wake.wait(lock, [this]() {
+                return pending.load(std::memory_order_seq_cst) > 0 || stopping.load(std::memory_order_acquire);
+            });
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            if (pending.load(std::memory_order_seq_cst) == 0 && stopping.load(std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t threadCount = std::max(1u, std::thread::hardware_concurrency())) {
+        if (threadCount == 0) {
+            threadCount = 1;
+        }
+        workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers.push_back(std::make_unique<Worker>());
+        }
+        threads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            threads.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ~ThreadPool() { shutdown(); }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Asteapta terminarea task-urilor deja trimise si opreste worker-ii
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            if (stopping.exchange(true)) {
+                return;
+            }
+            wake.notify_all();
+        }
+        for (auto& t : threads) {
+            if (t.joinable()) {
+                t.join();
+            }
+        }
+    }
+
+    template <typename F, typename... Args>
+    auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> {
+        using Result = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            [fn = std::forward<F>(f), tuple = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+                return std::apply(std::move(fn), std::move(tuple));
+            });
+        std::future<Result> result = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return result;
+    }
+
+    // Ruleaza un task din pool pe thread-ul curent (daca exista unul).
+    // Folosit de cine asteapta rezultate, ca sa nu blocheze un worker degeaba.
+    bool runPendingTask() {
+        const WorkerIdentity& id = identity();
+        size_t start = id.pool == this ? id.index : nextWorker.load(std::memory_order_relaxed) % workers.size();
+        Task task;
+        if (!findTask(start, task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    // body(i) pentru i in [begin, end), impartit in bucati de cel putin `grain`
+    // indici. Thread-ul apelant lucreaza si el; prima exceptie e re-aruncata.
+    // Apelantul asteapta doar bucatile acestui apel, nu ruleaza alte task-uri
+    // din pool, deci poate fi apelat si de pe un worker.
+    template <typename Index, typename Body>
+    void parallel_for(Index begin, Index end, Body body, size_t grain = 1) {
+        if (end <= begin) {
+            return;
+        }
+        const size_t count = static_cast<size_t>(end - begin);
+        grain = std::max<size_t>(grain, count / (workers.size() * 4) + 1);
+        const size_t chunks = (count + grain - 1) / grain;
+
+        struct Shared {
+            std::atomic<size_t> nextChunk{0};
+            std::atomic<size_t> active{0};      // helper-i care au intrat in work()
+            std::atomic<bool> closed{false};    // apelantul nu mai asteapta pe nimeni
+            std::atomic<bool> failed{false};
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+        auto shared = std::make_shared<Shared>();
+
+        auto work = [shared, begin, count, grain, chunks, &body]() {
+            for (;;) {
+                size_t chunk = shared->nextChunk.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= chunks || shared->failed.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                size_t first = chunk * grain;
+                size_t last = std::min(first + grain, count);
+                try {
+                    for (size_t i = first; i < last; ++i) {
+                        body(static_cast<Index>(begin + static_cast<Index>(i)));
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(shared->errorMutex);
+                    if (!shared->error) {
+                        shared->error = std::current_exception();
+                    }
+                    shared->failed.store(true, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        // Un helper intra (active++) si abia apoi verifica closed; apelantul
+        // seteaza closed si abia apoi citeste active (seq_cst pe ambele parti).
+        // Deci fie apelantul il vede si il asteapta, fie helper-ul vede closed
+        // si iese fara sa atinga &body. Helper-ii ramasi in cozi nu sunt
+        // asteptati: cand ajung sa ruleze, ies imediat.
+        auto waitHelpers = [&shared]() {
+            shared->closed.store(true);
+            while (shared->active.load() != 0) {
+                std::this_thread::yield();
+            }
+        };
+
+        const size_t maxHelpers = std::min(chunks - 1, workers.size());
+        try {
+            for (size_t helper = 0; helper < maxHelpers; ++helper) {
+                enqueue([work, shared]() {
+                    shared->active.fetch_add(1);
+                    if (!shared->closed.load()) {
+                        work();
+                    }
+                    shared->active.fetch_sub(1, std::memory_order_release);
+                });
+            }
+        } catch (...) {
+            // enqueue a esuat (ex. shutdown concurent): helper-ii care au apucat
+            // sa porneasca tin &body, deci se termina inainte ca exceptia sa
+            // distruga cadrul. failed ii face sa iasa fara sa mai ia bucati
+            shared->failed.store(true, std::memory_order_relaxed);
+            waitHelpers();
+            throw;
+        }
+        // Dupa work() toate bucatile sunt luate; asteptam doar helper-ii care
+        // inca lucreaza la una
+        work();
+        waitHelpers();
+        if (shared->error) {
+            std::rethrow_exception(shared->error);
+        }
+    }
+
+    size_t threadCount() const { return threads.size(); }
+};
+
+#endif // THREAD_POOL_HPP
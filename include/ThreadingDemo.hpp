@@ -1,499 +1,904 @@
-#ifndef THREADING_DEMO_HPP
-#define THREADING_DEMO_HPP
-
-#include <iostream>
-#include <thread>
-#include <mutex>
-#include <fstream>
-#include <string>
-#include <vector>
-#include <chrono>
-#include <sstream>
-#include <atomic>
-
-/**
- * ============================================================================
- * THREADING DEMO: Sincronizare cu Mutex vs Fara Sincronizare
- * ============================================================================
- * 
- * Demonstreaza:
- * 1. Probleme care apar FARA sincronizare (race conditions)
- * 2. Solutia cu MUTEX pentru sincronizare corecta
- * 3. RAII pentru mutex (std::lock_guard, std::unique_lock)
- * 4. Exemplu cu file descriptor - un thread scrie, altul citeste
- */
-
-// ============================================================================
-// Clasa pentru managementul fisierului cu RAII
-// ============================================================================
-class ThreadSafeFile {
-private:
-    std::fstream file;
-    std::string filename;
-    mutable std::mutex fileMutex;  // Mutex pentru sincronizare
-    bool isOpen;
-
-public:
-    explicit ThreadSafeFile(const std::string& fname) 
-        : filename(fname), isOpen(false) {
-        // Cream fisierul daca nu exista
-        file.open(fname, std::ios::out | std::ios::trunc);
-        if (file.is_open()) {
-            file.close();
-        }
-        // Redeschidem pentru read/write
-        file.open(fname, std::ios::in | std::ios::out);
-        isOpen = file.is_open();
-        std::cout << "[ThreadSafeFile] Fisier deschis: " << fname << std::endl;
-    }
-    
-    ~ThreadSafeFile() {
-        if (isOpen) {
-            file.close();
-            std::cout << "[ThreadSafeFile] Fisier inchis: " << filename << std::endl;
-        }
-    }
-    
-    // Disable copying
-    ThreadSafeFile(const ThreadSafeFile&) = delete;
-    ThreadSafeFile& operator=(const ThreadSafeFile&) = delete;
-    
-    // Scriere SINCRONIZATA cu mutex
-    void writeSync(const std::string& data, int threadId) {
-        std::lock_guard<std::mutex> lock(fileMutex);  // RAII lock
-        
-        if (isOpen && file.is_open()) {
-            file.seekp(0, std::ios::end);
-            file << "[Thread " << threadId << "] " << data << "\n";
-            file.flush();
-            std::cout << "[SYNC Write] Thread " << threadId << ": " << data << std::endl;
-        }
-    }
-    
-    // Citire SINCRONIZATA cu mutex
-    std::string readSync(int threadId) {
-        std::lock_guard<std::mutex> lock(fileMutex);  // RAII lock
-        
-        std::string content;
-        if (isOpen && file.is_open()) {
-            file.seekg(0);
-            std::string line;
-            while (std::getline(file, line)) {
-                content += line + "\n";
-            }
-            file.clear();  // Clear EOF flag
-            std::cout << "[SYNC Read] Thread " << threadId << " a citit " 
-                      << content.length() << " caractere" << std::endl;
-        }
-        return content;
-    }
-    
-    // Scriere NESINCRONIZATA (pentru demonstratie probleme)
-    void writeUnsafe(const std::string& data, int threadId) {
-        // FARA LOCK - poate cauza race conditions!
-        if (isOpen && file.is_open()) {
-            file.seekp(0, std::ios::end);
-            file << "[Thread " << threadId << "] " << data << "\n";
-            file.flush();
-            std::cout << "[UNSAFE Write] Thread " << threadId << ": " << data << std::endl;
-        }
-    }
-    
-    // Citire NESINCRONIZATA
-    std::string readUnsafe(int threadId) {
-        // FARA LOCK - poate cauza race conditions!
-        std::string content;
-        if (isOpen && file.is_open()) {
-            file.seekg(0);
-            std::string line;
-            while (std::getline(file, line)) {
-                content += line + "\n";
-            }
-            file.clear();
-            std::cout << "[UNSAFE Read] Thread " << threadId << " a citit " 
-                      << content.length() << " caractere" << std::endl;
-        }
-        return content;
-    }
-    
-    std::mutex& getMutex() { return fileMutex; }
-};
-
-// ============================================================================
-// Exemplu simplu: Counter cu si fara sincronizare
-// ============================================================================
-class Counter {
-private:
-    int unsafeValue;
-    std::atomic<int> atomicValue;
-    int mutexValue;
-    std::mutex counterMutex;
-
-public:
-    Counter() : unsafeValue(0), atomicValue(0), mutexValue(0) {}
-    
-    // Incrementare NESIGURA (race condition)
-    void incrementUnsafe() {
-        int temp = unsafeValue;
-        // Simulam o operatie care ia timp
-        std::this_thread::sleep_for(std::chrono::microseconds(1));
-        unsafeValue = temp + 1;
-    }
-    
-    // Incrementare cu ATOMIC (lock-free)
-    void incrementAtomic() {
-        atomicValue++;
-    }
-    
-    // Incrementare cu MUTEX
-    void incrementMutex() {
-        std::lock_guard<std::mutex> lock(counterMutex);
-        mutexValue++;
-    }
-    
-    int getUnsafe() const { return unsafeValue; }
-    int getAtomic() const { return atomicValue; }
-    int getMutex() const { return mutexValue; }
-};
-
-// ============================================================================
-// Demonstratie: FARA sincronizare (probleme)
-// ============================================================================
-inline void demonstrateWithoutSync() {
-    std::cout << "\n";
-    std::cout << "============================================================\n";
-    std::cout << "  EXEMPLU FARA SINCRONIZARE (Race Conditions)\n";
-    std::cout << "============================================================\n";
-    
-    std::cout << "\n--- Counter fara sincronizare ---\n" << std::endl;
-    
-    Counter counter;
-    const int numIncrements = 1000;
-    
-    auto incrementTask = [&counter, numIncrements]() {
-        for (int i = 0; i < numIncrements; ++i) {
-            counter.incrementUnsafe();
-        }
-    };
-    
-    std::cout << "Pornim 2 thread-uri, fiecare incrementeaza de " << numIncrements << " ori" << std::endl;
-    std::cout << "Valoare asteptata: " << (2 * numIncrements) << std::endl;
-    
-    std::thread t1(incrementTask);
-    std::thread t2(incrementTask);
-    
-    t1.join();
-    t2.join();
-    
-    std::cout << "\nValoare obtinuta (UNSAFE): " << counter.getUnsafe() << std::endl;
-    std::cout << "PROBLEMA: Valoarea este probabil MAI MICA decat " << (2 * numIncrements) << "!" << std::endl;
-    std::cout << "Cauza: Race condition - thread-urile suprascriu valorile celuilalt\n" << std::endl;
-    
-    // Demonstratie cu fisier
-    std::cout << "\n--- Scriere in fisier fara sincronizare ---\n" << std::endl;
-    
-    {
-        ThreadSafeFile file("unsafe_demo.txt");
-        
-        auto writerTask = [&file](int threadId) {
-            for (int i = 0; i < 3; ++i) {
-                std::stringstream ss;
-                ss << "Mesaj " << i << " de la thread " << threadId;
-                file.writeUnsafe(ss.str(), threadId);
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            }
-        };
-        
-        auto readerTask = [&file](int threadId) {
-            for (int i = 0; i < 2; ++i) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(15));
-                file.readUnsafe(threadId);
-            }
-        };
-        
-        std::thread writer1(writerTask, 1);
-        std::thread writer2(writerTask, 2);
-        std::thread reader(readerTask, 3);
-        
-        writer1.join();
-        writer2.join();
-        reader.join();
-        
-        std::cout << "\nPROBLEME POSIBILE:" << std::endl;
-        std::cout << "- Date corupte sau incomplete" << std::endl;
-        std::cout << "- Mesaje intercalate incorect" << std::endl;
-        std::cout << "- Citiri inconsistente" << std::endl;
-    }
-}
-
-// ============================================================================
-// Demonstratie: CU sincronizare (corect)
-// ============================================================================
-inline void demonstrateWithSync() {
-    std::cout << "\n";
-    std::cout << "============================================================\n";
-    std::cout << "  EXEMPLU CU SINCRONIZARE (Mutex)\n";
-    std::cout << "============================================================\n";
-    
-    std::cout << "\n--- Counter cu sincronizare ---\n" << std::endl;
-    
-    Counter counter;
-    const int numIncrements = 1000;
-    
-    // Test cu atomic
-    auto atomicTask = [&counter, numIncrements]() {
-        for (int i = 0; i < numIncrements; ++i) {
-            counter.incrementAtomic();
-        }
-    };
-    
-    // Test cu mutex
-    auto mutexTask = [&counter, numIncrements]() {
-        for (int i = 0; i < numIncrements; ++i) {
-            counter.incrementMutex();
-        }
-    };
-    
-    std::cout << "Test cu std::atomic:" << std::endl;
-    std::thread t1(atomicTask);
-    std::thread t2(atomicTask);
-    t1.join();
-    t2.join();
-    std::cout << "Valoare ATOMIC: " << counter.getAtomic() << " (asteptat: " << (2 * numIncrements) << ")" << std::endl;
-    
-    std::cout << "\nTest cu std::mutex:" << std::endl;
-    std::thread t3(mutexTask);
-    std::thread t4(mutexTask);
-    t3.join();
-    t4.join();
-    std::cout << "Valoare MUTEX: " << counter.getMutex() << " (asteptat: " << (2 * numIncrements) << ")" << std::endl;
-    
-    std::cout << "\nAmbele metode dau rezultatul CORECT!\n" << std::endl;
-    
-    // Demonstratie cu fisier sincronizat
-    std::cout << "\n--- Scriere/Citire in fisier CU sincronizare ---\n" << std::endl;
-    
-    {
-        ThreadSafeFile file("sync_demo.txt");
-        
-        auto writerTask = [&file](int threadId) {
-            for (int i = 0; i < 3; ++i) {
-                std::stringstream ss;
-                ss << "Mesaj " << i << " de la thread " << threadId;
-                file.writeSync(ss.str(), threadId);
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            }
-        };
-        
-        auto readerTask = [&file](int threadId) {
-            for (int i = 0; i < 2; ++i) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(25));
-                std::string content = file.readSync(threadId);
-            }
-        };
-        
-        std::thread writer1(writerTask, 1);
-        std::thread writer2(writerTask, 2);
-        std::thread reader(readerTask, 3);
-        
-        writer1.join();
-        writer2.join();
-        reader.join();
-        
-        std::cout << "\nCu MUTEX:" << std::endl;
-        std::cout << "- Fiecare operatie este atomica" << std::endl;
-        std::cout << "- Nu exista date corupte" << std::endl;
-        std::cout << "- Citirile sunt consistente" << std::endl;
-    }
-}
-
-// ============================================================================
-// Demonstratie: RAII pentru Mutex (lock_guard, unique_lock)
-// ============================================================================
-inline void demonstrateMutexRAII() {
-    std::cout << "\n";
-    std::cout << "============================================================\n";
-    std::cout << "  RAII pentru Mutex: lock_guard si unique_lock\n";
-    std::cout << "============================================================\n";
-    
-    std::mutex mtx;
-    int sharedData = 0;
-    
-    std::cout << "\n--- std::lock_guard (simplu, RAII) ---\n" << std::endl;
-    {
-        std::cout << "Intram in scope si luam lock-ul..." << std::endl;
-        std::lock_guard<std::mutex> lock(mtx);
-        
-        sharedData = 42;
-        std::cout << "Am modificat sharedData = " << sharedData << std::endl;
-        std::cout << "Lock-ul se elibereaza automat la iesirea din scope" << std::endl;
-    }
-    std::cout << "Lock eliberat!\n" << std::endl;
-    
-    std::cout << "\n--- std::unique_lock (flexibil) ---\n" << std::endl;
-    {
-        std::unique_lock<std::mutex> lock(mtx);
-        std::cout << "Lock luat" << std::endl;
-        
-        sharedData = 100;
-        
-        lock.unlock();
-        std::cout << "Lock eliberat manual (pentru operatii care nu necesita lock)" << std::endl;
-        
-        // Operatii fara lock...
-        std::cout << "Facem operatii fara lock..." << std::endl;
-        
-        lock.lock();
-        std::cout << "Lock reluat" << std::endl;
-        
-        sharedData = 200;
-        std::cout << "sharedData = " << sharedData << std::endl;
-    }
-    
-    std::cout << "\n--- Avantaje RAII pentru mutex ---" << std::endl;
-    std::cout << "1. Lock-ul se elibereaza automat (chiar si la exceptii)" << std::endl;
-    std::cout << "2. Nu poti uita sa faci unlock" << std::endl;
-    std::cout << "3. Exception-safe" << std::endl;
-    std::cout << "4. Cod mai curat si mai sigur" << std::endl;
-}
-
-// ============================================================================
-// Exemplu complet: Producer-Consumer cu fisier
-// ============================================================================
-inline void demonstrateProducerConsumer() {
-    std::cout << "\n";
-    std::cout << "============================================================\n";
-    std::cout << "  Producer-Consumer: Un thread scrie, altul citeste\n";
-    std::cout << "============================================================\n";
-    
-    std::mutex fileMutex;
-    std::string sharedFilename = "producer_consumer.txt";
-    std::atomic<bool> done(false);
-    std::atomic<int> messagesWritten(0);
-    
-    // Cream fisierul
-    {
-        std::ofstream file(sharedFilename, std::ios::trunc);
-        file << "=== Log Start ===\n";
-    }
-    
-    // Producer thread - scrie in fisier
-    auto producer = [&]() {
-        std::cout << "[Producer] Pornit" << std::endl;
-        
-        for (int i = 1; i <= 5; ++i) {
-            {
-                std::lock_guard<std::mutex> lock(fileMutex);
-                
-                std::ofstream file(sharedFilename, std::ios::app);
-                if (file.is_open()) {
-                    file << "Mesaj #" << i << " - timestamp: " 
-                         << std::chrono::system_clock::now().time_since_epoch().count() << "\n";
-                    file.flush();
-                    std::cout << "[Producer] Scris mesaj #" << i << std::endl;
-                    messagesWritten++;
-                }
-            }
-            
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        }
-        
-        done = true;
-        std::cout << "[Producer] Terminat" << std::endl;
-    };
-    
-    // Consumer thread - citeste din fisier
-    auto consumer = [&]() {
-        std::cout << "[Consumer] Pornit" << std::endl;
-        int lastCount = 0;
-        
-        while (!done || messagesWritten > lastCount) {
-            {
-                std::lock_guard<std::mutex> lock(fileMutex);
-                
-                std::ifstream file(sharedFilename);
-                if (file.is_open()) {
-                    std::string content((std::istreambuf_iterator<char>(file)),
-                                        std::istreambuf_iterator<char>());
-                    
-                    int currentCount = messagesWritten;
-                    if (currentCount > lastCount) {
-                        std::cout << "[Consumer] Citit " << content.length() 
-                                  << " bytes, " << currentCount << " mesaje" << std::endl;
-                        lastCount = currentCount;
-                    }
-                }
-            }
-            
-            std::this_thread::sleep_for(std::chrono::milliseconds(150));
-        }
-        
-        // Citire finala
-        {
-            std::lock_guard<std::mutex> lock(fileMutex);
-            std::ifstream file(sharedFilename);
-            std::string content((std::istreambuf_iterator<char>(file)),
-                                std::istreambuf_iterator<char>());
-            std::cout << "\n[Consumer] Continut final:\n" << content << std::endl;
-        }
-        
-        std::cout << "[Consumer] Terminat" << std::endl;
-    };
-    
-    std::thread producerThread(producer);
-    std::thread consumerThread(consumer);
-    
-    producerThread.join();
-    consumerThread.join();
-    
-    std::cout << "\nProducer-Consumer finalizat cu succes!" << std::endl;
-    std::cout << "Mutex-ul a asigurat ca operatiile sunt atomice." << std::endl;
-}
-
-// ============================================================================
-// Functie principala de demonstratie
-// ============================================================================
-inline void demonstrateThreading() {
-    std::cout << "\n";
-    std::cout << "************************************************************\n";
-    std::cout << "*                                                          *\n";
-    std::cout << "*     THREADING: Sincronizare cu Mutex                    *\n";
-    std::cout << "*     (Ilustrare din poza: threaduri sincronizate         *\n";
-    std::cout << "*      si desincronizate care manageuiesc aceleasi        *\n";
-    std::cout << "*      resurse)                                           *\n";
-    std::cout << "*                                                          *\n";
-    std::cout << "************************************************************\n";
-    
-    std::cout << "\nVom demonstra:" << std::endl;
-    std::cout << "1. Ce se intampla FARA sincronizare (race conditions)" << std::endl;
-    std::cout << "2. Cum rezolvam cu MUTEX (sincronizare corecta)" << std::endl;
-    std::cout << "3. RAII pentru mutex (lock_guard, unique_lock)" << std::endl;
-    std::cout << "4. Producer-Consumer: un thread scrie, altul citeste\n" << std::endl;
-    
-    demonstrateWithoutSync();
-    demonstrateWithSync();
-    demonstrateMutexRAII();
-    demonstrateProducerConsumer();
-    
-    std::cout << "\n";
-    std::cout << "============================================================\n";
-    std::cout << "  REZUMAT THREADING\n";
-    std::cout << "============================================================\n";
-    std::cout << "\nProbleme FARA sincronizare:" << std::endl;
-    std::cout << "- Race conditions: rezultate imprevizibile" << std::endl;
-    std::cout << "- Date corupte" << std::endl;
-    std::cout << "- Comportament nedeterminist" << std::endl;
-    
-    std::cout << "\nSolutii pentru sincronizare:" << std::endl;
-    std::cout << "- std::mutex + std::lock_guard (RAII)" << std::endl;
-    std::cout << "- std::atomic pentru operatii simple" << std::endl;
-    std::cout << "- std::unique_lock pentru control mai fin" << std::endl;
-    
-    std::cout << "\nBest practices:" << std::endl;
-    std::cout << "- Foloseste RAII pentru lock-uri (lock_guard)" << std::endl;
-    std::cout << "- Minimizeaza timpul cat tii lock-ul" << std::endl;
-    std::cout << "- Evita deadlock-uri (ordinea lock-urilor)" << std::endl;
-    std::cout << "- Prefera std::atomic pentru operatii simple" << std::endl;
-}
-
-#endif // THREADING_DEMO_HPP
+#ifndef THREADING_DEMO_HPP
+#define THREADING_DEMO_HPP
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <mutex>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <sstream>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+
+#include "MpscRingBuffer.hpp"
+#include "FileTailReader.hpp"
+#include "PlatformIO.hpp"
+#include "MappedFile.hpp"
+#include "StripedCounter.hpp"
+#include "ThreadPool.hpp"
+#include "Logger.hpp"
+
+/**
+ * ============================================================================
+ * THREADING DEMO: Sincronizare cu Mutex vs Fara Sincronizare
+ * ============================================================================
+ * 
+ * Demonstreaza:
+ * 1. Probleme care apar FARA sincronizare (race conditions)
+ * 2. Solutia cu MUTEX pentru sincronizare corecta
+ * 3. RAII pentru mutex (std::lock_guard, std::unique_lock)
+ * 4. Exemplu cu file descriptor - un thread scrie, altul citeste
+ */
+
+// ============================================================================
+// Durabilitate pentru scrierea asincrona (group commit)
+// ============================================================================
+enum class Durability {
+    PerRecord,    // writeAsync asteapta pana cand inregistrarea ajunge in fisier
+    PerBatch,     // un singur flush pentru fiecare batch scris de flusher
+    TimeBounded   // flush cel mult o data la flushInterval (fereastra de pierdere limitata)
+};
+
+// ============================================================================
+// Clasa pentru managementul fisierului cu RAII
+// ============================================================================
+class ThreadSafeFile {
+private:
+    std::fstream file;
+    std::string filename;
+    mutable std::mutex fileMutex;  // Serializeaza doar writer-ii intre ei
+    bool isOpen;
+    
+    // Citirile nu iau fileMutex: folosesc un descriptor separat si citesc
+    // pozitional (pread) pana la lungimea publicata de writer-i dupa flush.
+    // committedLength = (secventa << 48) | lungime; secventa e folosita doar
+    // in modul append lock-free (vezi appendRaw), altfel e 0
+    static constexpr unsigned kSeqShift = 48;
+    static constexpr uint64_t kLengthMask = (uint64_t(1) << kSeqShift) - 1;
+    static constexpr uint64_t kSeqOne = uint64_t(1) << kSeqShift;
+    PositionalFile reader;
+    std::atomic<uint64_t> committedLength{0};
+    
+    // Apelat sub fileMutex, dupa flush: octetii [0, lungime) sunt in fisier
+    void publishLength() {
+        std::streamoff end = file.tellp();
+        if (end >= 0) {
+            committedLength.store(static_cast<uint64_t>(end), std::memory_order_release);
+        }
+    }
+    
+    // Mod append lock-free: fiecare writer rezerva atomic un interval de
+    // octeti si scrie pozitional (pwrite) in el, fara fileMutex
+    static constexpr size_t kCompletionSlots = 1024;   // divide 2^16
+    PositionalFile appender;
+    std::atomic<uint64_t> appendOffset{0};      // (secventa << 48) | urmatorul octet nerezervat
+    std::unique_ptr<std::atomic<uint64_t>[]> completions;
+    std::atomic<bool> lockFreeAppend{false};
+    std::atomic<uint64_t> appendFailures{0};
+    
+    // Avanseaza committedLength peste toate rezervarile terminate, in ordine.
+    // completions[s % N] contine starea de dupa rezervarea s, (s + 1, sfarsit);
+    // oricine gaseste slot-ul urmator completat il publica prin CAS.
+    // seq_cst: writer-ul face store(slot) + load(stare), cel care avanseaza
+    // face CAS(stare) + load(slot) - macar unul vede scrierea celuilalt
+    void advanceCommitted() {
+        uint64_t state = committedLength.load(std::memory_order_seq_cst);
+        for (;;) {
+            uint64_t seq = state >> kSeqShift;
+            uint64_t next = completions[seq % kCompletionSlots].load(std::memory_order_seq_cst);
+            if ((next >> kSeqShift) != ((seq + 1) & 0xFFFF)) {
+                return;   // rezervarea seq inca nu e scrisa: o va publica writer-ul ei
+            }
+            committedLength.compare_exchange_weak(state, next, std::memory_order_seq_cst);
+        }
+    }
+    
+    // Rezerva [offset, offset + size) impreuna cu un numar de secventa, scrie
+    // acolo si marcheaza rezervarea ca terminata. Writer-ii nu se asteapta
+    // intre ei: un writer intarziat doar amana publicarea celor de dupa el,
+    // pe care o face el insusi cand termina. Singura asteptare: cand sunt
+    // kCompletionSlots rezervari nepublicate (inelul e plin).
+    void appendRaw(const char* data, size_t size) {
+        uint64_t ticket = appendOffset.fetch_add(kSeqOne + size, std::memory_order_relaxed);
+        uint64_t seq = ticket >> kSeqShift;
+        uint64_t offset = ticket & kLengthMask;
+        if (!appender.writeAt(offset, data, size)) {
+            // Intervalul ramane cu zerouri; il marcam oricum terminat, altfel
+            // nimic de dupa el nu ar mai fi publicat
+            appendFailures.fetch_add(1, std::memory_order_relaxed);
+        }
+        for (unsigned spins = 0;
+             ((seq - (committedLength.load(std::memory_order_acquire) >> kSeqShift)) & 0xFFFF) >= kCompletionSlots;
+             ++spins) {
+            if (spins >= 64) {
+                std::this_thread::yield();
+            }
+        }
+        completions[seq % kCompletionSlots].store(((seq + 1) << kSeqShift) | (offset + size),
+                                                  std::memory_order_seq_cst);
+        advanceCommitted();
+    }
+    
+    void appendRecord(const std::string& data, int threadId) {
+        thread_local std::string buffer;  // formatare fara alocari dupa primul apel
+        buffer.clear();
+        buffer += "[Thread ";
+        buffer += std::to_string(threadId);
+        buffer += "] ";
+        buffer += data;
+        buffer += '\n';
+        appendRaw(buffer.data(), buffer.size());
+        LOG_DEBUG("[APPEND Write] Thread " << threadId << ": " << data);
+    }
+    
+    // Mod asincron: apelantii doar adauga in coada, un thread flusher
+    // scrie inregistrarile in batch-uri mari (o scriere + un flush per batch)
+    std::mutex queueMutex;
+    std::condition_variable queueCv;     // trezeste flusher-ul
+    std::condition_variable durableCv;   // trezeste cei care asteapta flush-ul
+    std::string pending;                 // inregistrari formatate, inca nescrise
+    uint64_t enqueuedSeq = 0;            // cate inregistrari au intrat in coada
+    uint64_t durableSeq = 0;             // cate inregistrari au ajuns in fisier (flush)
+    bool asyncRunning = false;
+    bool stopRequested = false;
+    Durability durability = Durability::PerBatch;
+    std::chrono::milliseconds flushInterval{5};
+    std::thread flusher;
+    
+    void flusherLoop() {
+        std::string batch;
+        uint64_t writtenSeq = 0;  // scris in stream, dar posibil inca in buffer
+        auto lastFlush = std::chrono::steady_clock::now();
+        
+        std::unique_lock<std::mutex> lock(queueMutex);
+        while (true) {
+            auto hasWork = [this] { return stopRequested || !pending.empty(); };
+            if (durability == Durability::TimeBounded && writtenSeq > durableSeq) {
+                queueCv.wait_until(lock, lastFlush + flushInterval, hasWork);
+            } else {
+                queueCv.wait(lock, hasWork);
+            }
+            
+            batch.swap(pending);
+            uint64_t batchSeq = enqueuedSeq;
+            bool stopping = stopRequested;
+            lock.unlock();
+            
+            auto now = std::chrono::steady_clock::now();
+            bool doFlush = durability != Durability::TimeBounded
+                           || stopping || now - lastFlush >= flushInterval;
+            {
+                std::lock_guard<std::mutex> fileLock(fileMutex);
+                if (lockFreeAppend.load(std::memory_order_relaxed)) {
+                    if (!batch.empty()) {
+                        appendRaw(batch.data(), batch.size());  // publicat imediat
+                    }
+                } else if (!batch.empty() && isOpen && file.is_open()) {
+                    file.seekp(0, std::ios::end);
+                    file.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                }
+                if (doFlush && isOpen && file.is_open() && !lockFreeAppend.load(std::memory_order_relaxed)) {
+                    file.flush();
+                    publishLength();
+                }
+            }
+            batch.clear();
+            
+            lock.lock();
+            writtenSeq = batchSeq;
+            if (doFlush) {
+                durableSeq = writtenSeq;
+                lastFlush = now;
+                durableCv.notify_all();
+            }
+            if (stopping && pending.empty()) {
+                // In aceeasi sectiune critica in care decidem sa iesim: un
+                // writeAsync care vine dupa nu mai pune nimic in coada, ci
+                // scrie sincron (altfel inregistrarea s-ar pierde)
+                asyncRunning = false;
+                break;
+            }
+        }
+    }
+
+public:
+    explicit ThreadSafeFile(const std::string& fname) 
+        : filename(fname), isOpen(false) {
+        // Cream fisierul daca nu exista
+        file.open(fname, std::ios::out | std::ios::trunc);
+        if (file.is_open()) {
+            file.close();
+        }
+        // Redeschidem pentru read/write
+        file.open(fname, std::ios::in | std::ios::out);
+        isOpen = file.is_open();
+        reader = PositionalFile(fname);
+        LOG_TRACE("[ThreadSafeFile] Fisier deschis: " << fname);
+    }
+    
+    ~ThreadSafeFile() {
+        stopAsync();
+        if (isOpen) {
+            file.close();
+            LOG_TRACE("[ThreadSafeFile] Fisier inchis: " << filename);
+        }
+    }
+    
+    // Disable copying
+    ThreadSafeFile(const ThreadSafeFile&) = delete;
+    ThreadSafeFile& operator=(const ThreadSafeFile&) = delete;
+    
+    // Scriere SINCRONIZATA cu mutex (in modul append lock-free: fara mutex)
+    void writeSync(const std::string& data, int threadId) {
+        if (lockFreeAppend.load(std::memory_order_acquire)) {
+            appendRecord(data, threadId);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(fileMutex);  // RAII lock
+        if (lockFreeAppend.load(std::memory_order_relaxed)) {
+            lock.unlock();  // modul a fost activat cat asteptam lock-ul
+            appendRecord(data, threadId);
+            return;
+        }
+        
+        if (isOpen && file.is_open()) {
+            file.seekp(0, std::ios::end);
+            file << "[Thread " << threadId << "] " << data << "\n";
+            file.flush();
+            publishLength();
+            LOG_DEBUG("[SYNC Write] Thread " << threadId << ": " << data);
+        }
+    }
+    
+    // Citire CONCURENTA: fara fileMutex, deci nu blocheaza writer-ii si nici
+    // ceilalti cititori. Vede un snapshot consistent: doar linii complete,
+    // publicate de writer-i dupa flush (release/acquire pe committedLength).
+    std::string readSync(int threadId) const {
+        std::string content;
+        uint64_t length = committedLength.load(std::memory_order_acquire) & kLengthMask;
+        if (reader.isOpen() && length > 0) {
+            content.resize(static_cast<size_t>(length));
+            content.resize(reader.readAt(0, &content[0], content.size()));
+            LOG_DEBUG("[SYNC Read] Thread " << threadId << " a citit " 
+                      << content.length() << " caractere");
+        }
+        return content;
+    }
+    
+    uint64_t committedSize() const { return committedLength.load(std::memory_order_acquire) & kLengthMask; }
+    
+    // ------------------------------------------------------------------------
+    // Mod APPEND LOCK-FREE (rezervare atomica de offset)
+    // ------------------------------------------------------------------------
+    
+    // Din acest moment writeSync (si flusher-ul din modul asincron) nu mai
+    // folosesc stream-ul: fiecare inregistrare e formatata intr-un buffer al
+    // thread-ului si scrisa cu pwrite in intervalul rezervat. Modul nu se
+    // poate dezactiva. false daca fisierul nu poate fi deschis pentru scriere.
+    bool enableLockFreeAppend() {
+        std::lock_guard<std::mutex> lock(fileMutex);
+        if (lockFreeAppend.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        if (!isOpen || !file.is_open()) {
+            return false;
+        }
+        appender = PositionalFile(filename, PositionalFile::Access::ReadWrite);
+        if (!appender.isOpen()) {
+            return false;
+        }
+        completions.reset(new std::atomic<uint64_t>[kCompletionSlots]);
+        for (size_t i = 0; i < kCompletionSlots; ++i) {
+            completions[i].store(0, std::memory_order_relaxed);   // secventa 0: nicio rezervare
+        }
+        file.flush();
+        file.seekp(0, std::ios::end);
+        publishLength();
+        // Secventa 0, de la lungimea curenta (acelasi format ca committedLength)
+        appendOffset.store(committedLength.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        lockFreeAppend.store(true, std::memory_order_release);
+        return true;
+    }
+    
+    bool isLockFreeAppend() const { return lockFreeAppend.load(std::memory_order_acquire); }
+    uint64_t appendFailureCount() const { return appendFailures.load(std::memory_order_relaxed); }
+    
+    // Recuperare dupa crash in modul append lock-free: un writer poate muri
+    // intre rezervare si pwrite, lasand o "gaura" de zerouri, iar ultima
+    // inregistrare poate fi scrisa doar partial. Regula: pastram prefixul
+    // pana la primul octet NUL, taiat la ultima linie completa ('\n').
+    // Inregistrarile de dupa o gaura se pierd - exact ce nu ar fi fost inca
+    // publicat prin committedLength. Intoarce noua lungime a fisierului
+    // (0 si daca fisierul nu poate fi deschis).
+    static uint64_t recoverTornTail(const std::string& path) {
+        uint64_t keep = 0;
+        {
+            MappedFile mapped(path);
+            if (!mapped.isMapped()) {
+                return 0;
+            }
+            std::string_view text = mapped.view();
+            std::string_view valid = text.substr(0, text.find('\0'));
+            size_t lastNewline = valid.rfind('\n');
+            keep = lastNewline == std::string_view::npos ? 0 : lastNewline + 1;
+            if (keep == text.size()) {
+                return keep;
+            }
+        }
+        PositionalFile file(path, PositionalFile::Access::ReadWrite);
+        if (!file.isOpen() || !file.truncate(keep)) {
+            return 0;
+        }
+        LOG_DEBUG("[ThreadSafeFile] Coada rupta eliminata: " << path << " -> " << keep << " octeti");
+        return keep;
+    }
+    
+    // Scriere NESINCRONIZATA (pentru demonstratie probleme)
+    void writeUnsafe(const std::string& data, int threadId) {
+        // FARA LOCK - poate cauza race conditions!
+        if (isOpen && file.is_open()) {
+            file.seekp(0, std::ios::end);
+            file << "[Thread " << threadId << "] " << data << "\n";
+            file.flush();
+            LOG_DEBUG("[UNSAFE Write] Thread " << threadId << ": " << data);
+        }
+    }
+    
+    // Citire NESINCRONIZATA
+    std::string readUnsafe(int threadId) {
+        // FARA LOCK - poate cauza race conditions!
+        std::string content;
+        if (isOpen && file.is_open()) {
+            file.seekg(0);
+            std::string line;
+            while (std::getline(file, line)) {
+                content += line + "\n";
+            }
+            file.clear();
+            LOG_DEBUG("[UNSAFE Read] Thread " << threadId << " a citit " 
+                      << content.length() << " caractere");
+        }
+        return content;
+    }
+    
+    // ------------------------------------------------------------------------
+    // Mod ASINCRON (group commit)
+    // ------------------------------------------------------------------------
+    
+    // Porneste thread-ul flusher; writeAsync nu mai face I/O pe thread-ul apelant
+    void startAsync(Durability mode = Durability::PerBatch,
+                    std::chrono::milliseconds interval = std::chrono::milliseconds(5)) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (asyncRunning || stopRequested) {
+            return;   // ruleaza deja sau e in curs de oprire
+        }
+        durability = mode;
+        flushInterval = interval;
+        stopRequested = false;
+        asyncRunning = true;
+        flusher = std::thread(&ThreadSafeFile::flusherLoop, this);
+    }
+    
+    // Scrie tot ce e in coada, face flush si opreste flusher-ul.
+    // asyncRunning e sters de flusher, la iesire; stopRequested ramane setat
+    // pana dupa join, ca un al doilea stopAsync sa nu faca join de doua ori
+    void stopAsync() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (!asyncRunning || stopRequested) {
+                return;
+            }
+            stopRequested = true;
+        }
+        queueCv.notify_one();
+        flusher.join();
+        
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopRequested = false;
+    }
+    
+    // Adauga inregistrarea in coada si revine imediat (exceptie: PerRecord,
+    // unde asteapta flush-ul - dar un singur flush acopera toti cei care asteapta)
+    void writeAsync(const std::string& data, int threadId) {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        if (!asyncRunning) {
+            lock.unlock();
+            writeSync(data, threadId);
+            return;
+        }
+        
+        bool wasEmpty = pending.empty();
+        pending += "[Thread ";
+        pending += std::to_string(threadId);
+        pending += "] ";
+        pending += data;
+        pending += '\n';
+        uint64_t mySeq = ++enqueuedSeq;
+        
+        if (wasEmpty) {
+            queueCv.notify_one();
+        }
+        if (durability == Durability::PerRecord) {
+            durableCv.wait(lock, [this, mySeq] { return durableSeq >= mySeq; });
+        }
+    }
+    
+    // Asteapta pana cand tot ce a fost pus in coada pana acum a ajuns in fisier
+    void waitDurable() {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        if (!asyncRunning) {
+            return;
+        }
+        uint64_t target = enqueuedSeq;
+        queueCv.notify_one();
+        durableCv.wait(lock, [this, target] { return durableSeq >= target; });
+    }
+    
+    std::mutex& getMutex() { return fileMutex; }
+};
+
+// ============================================================================
+// Exemplu simplu: Counter cu si fara sincronizare
+// ============================================================================
+class Counter {
+private:
+    int unsafeValue;
+    std::atomic<int> atomicValue;
+    int mutexValue;
+    std::mutex counterMutex;
+    StripedCounter stripedValue;  // slot-uri per thread, 64 biti
+
+public:
+    Counter() : unsafeValue(0), atomicValue(0), mutexValue(0) {}
+    
+    // Incrementare NESIGURA (race condition)
+    void incrementUnsafe() {
+        int temp = unsafeValue;
+        // Simulam o operatie care ia timp
+        std::this_thread::sleep_for(std::chrono::microseconds(1));
+        unsafeValue = temp + 1;
+    }
+    
+    // Incrementare cu ATOMIC (lock-free)
+    void incrementAtomic() {
+        atomicValue++;
+    }
+    
+    // Incrementare cu MUTEX
+    void incrementMutex() {
+        std::lock_guard<std::mutex> lock(counterMutex);
+        mutexValue++;
+    }
+    
+    // Incrementare STRIPED (fiecare thread in propria linie de cache)
+    void incrementStriped() {
+        stripedValue.increment();
+    }
+    
+    int getUnsafe() const { return unsafeValue; }
+    int getAtomic() const { return atomicValue; }
+    int getMutex() const { return mutexValue; }
+    uint64_t getStriped() const { return stripedValue.load(); }
+};
+
+// ============================================================================
+// Pool comun pentru demonstratii: thread-urile sunt create o singura data
+// si refolosite. 4 worker-i: producer-consumer tine ocupati 3 simultan.
+// ============================================================================
+inline ThreadPool& demoThreadPool() {
+    static ThreadPool pool(4);
+    return pool;
+}
+
+// ============================================================================
+// Demonstratie: FARA sincronizare (probleme)
+// ============================================================================
+inline void demonstrateWithoutSync() {
+    ThreadPool& pool = demoThreadPool();
+    std::cout << "\n";
+    std::cout << "============================================================\n";
+    std::cout << "  EXEMPLU FARA SINCRONIZARE (Race Conditions)\n";
+    std::cout << "============================================================\n";
+    
+    std::cout << "\n--- Counter fara sincronizare ---\n" << std::endl;
+    
+    Counter counter;
+    const int numIncrements = 1000;
+    
+    auto incrementTask = [&counter, numIncrements]() {
+        for (int i = 0; i < numIncrements; ++i) {
+            counter.incrementUnsafe();
+        }
+    };
+    
+    std::cout << "Pornim 2 thread-uri, fiecare incrementeaza de " << numIncrements << " ori" << std::endl;
+    std::cout << "Valoare asteptata: " << (2 * numIncrements) << std::endl;
+    
+    auto t1 = pool.submit(incrementTask);
+    auto t2 = pool.submit(incrementTask);
+    
+    t1.get();
+    t2.get();
+    
+    std::cout << "\nValoare obtinuta (UNSAFE): " << counter.getUnsafe() << std::endl;
+    std::cout << "PROBLEMA: Valoarea este probabil MAI MICA decat " << (2 * numIncrements) << "!" << std::endl;
+    std::cout << "Cauza: Race condition - thread-urile suprascriu valorile celuilalt\n" << std::endl;
+    
+    // Demonstratie cu fisier
+    std::cout << "\n--- Scriere in fisier fara sincronizare ---\n" << std::endl;
+    
+    {
+        ThreadSafeFile file("unsafe_demo.txt");
+        
+        auto writerTask = [&file](int threadId) {
+            for (int i = 0; i < 3; ++i) {
+                std::stringstream ss;
+                ss << "Mesaj " << i << " de la thread " << threadId;
+                file.writeUnsafe(ss.str(), threadId);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        };
+        
+        auto readerTask = [&file](int threadId) {
+            for (int i = 0; i < 2; ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(15));
+                file.readUnsafe(threadId);
+            }
+        };
+        
+        auto writer1 = pool.submit(writerTask, 1);
+        auto writer2 = pool.submit(writerTask, 2);
+        auto reader = pool.submit(readerTask, 3);
+        
+        writer1.get();
+        writer2.get();
+        reader.get();
+        
+        std::cout << "\nPROBLEME POSIBILE:" << std::endl;
+        std::cout << "- Date corupte sau incomplete" << std::endl;
+        std::cout << "- Mesaje intercalate incorect" << std::endl;
+        std::cout << "- Citiri inconsistente" << std::endl;
+    }
+}
+
+// ============================================================================
+// Demonstratie: CU sincronizare (corect)
+// ============================================================================
+inline void demonstrateWithSync() {
+    ThreadPool& pool = demoThreadPool();
+    std::cout << "\n";
+    std::cout << "============================================================\n";
+    std::cout << "  EXEMPLU CU SINCRONIZARE (Mutex)\n";
+    std::cout << "============================================================\n";
+    
+    std::cout << "\n--- Counter cu sincronizare ---\n" << std::endl;
+    
+    Counter counter;
+    const int numIncrements = 1000;
+    
+    // Test cu atomic
+    auto atomicTask = [&counter, numIncrements]() {
+        for (int i = 0; i < numIncrements; ++i) {
+            counter.incrementAtomic();
+        }
+    };
+    
+    // Test cu mutex
+    auto mutexTask = [&counter, numIncrements]() {
+        for (int i = 0; i < numIncrements; ++i) {
+            counter.incrementMutex();
+        }
+    };
+    
+    std::cout << "Test cu std::atomic:" << std::endl;
+    auto t1 = pool.submit(atomicTask);
+    auto t2 = pool.submit(atomicTask);
+    t1.get();
+    t2.get();
+    std::cout << "Valoare ATOMIC: " << counter.getAtomic() << " (asteptat: " << (2 * numIncrements) << ")" << std::endl;
+    
+    std::cout << "\nTest cu std::mutex:" << std::endl;
+    auto t3 = pool.submit(mutexTask);
+    auto t4 = pool.submit(mutexTask);
+    t3.get();
+    t4.get();
+    std::cout << "Valoare MUTEX: " << counter.getMutex() << " (asteptat: " << (2 * numIncrements) << ")" << std::endl;
+    
+    // Test cu contor striped
+    auto stripedTask = [&counter, numIncrements]() {
+        for (int i = 0; i < numIncrements; ++i) {
+            counter.incrementStriped();
+        }
+    };
+    
+    std::cout << "\nTest cu StripedCounter:" << std::endl;
+    auto t5 = pool.submit(stripedTask);
+    auto t6 = pool.submit(stripedTask);
+    t5.get();
+    t6.get();
+    std::cout << "Valoare STRIPED: " << counter.getStriped() << " (asteptat: " << (2 * numIncrements) << ")" << std::endl;
+    
+    std::cout << "\nToate metodele dau rezultatul CORECT!\n" << std::endl;
+    
+    // Demonstratie cu fisier sincronizat
+    std::cout << "\n--- Scriere/Citire in fisier CU sincronizare ---\n" << std::endl;
+    
+    {
+        ThreadSafeFile file("sync_demo.txt");
+        
+        auto writerTask = [&file](int threadId) {
+            for (int i = 0; i < 3; ++i) {
+                std::stringstream ss;
+                ss << "Mesaj " << i << " de la thread " << threadId;
+                file.writeSync(ss.str(), threadId);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        };
+        
+        auto readerTask = [&file](int threadId) {
+            for (int i = 0; i < 2; ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(25));
+                std::string content = file.readSync(threadId);
+            }
+        };
+        
+        auto writer1 = pool.submit(writerTask, 1);
+        auto writer2 = pool.submit(writerTask, 2);
+        auto reader = pool.submit(readerTask, 3);
+        
+        writer1.get();
+        writer2.get();
+        reader.get();
+        
+        std::cout << "\nCu MUTEX:" << std::endl;
+        std::cout << "- Fiecare operatie este atomica" << std::endl;
+        std::cout << "- Nu exista date corupte" << std::endl;
+        std::cout << "- Citirile sunt consistente (doar linii complete, publicate dupa flush)" << std::endl;
+        std::cout << "- readSync foloseste pread: cititorii nu blocheaza writer-ii" << std::endl;
+    }
+    
+    // Demonstratie cu scriere asincrona (group commit)
+    std::cout << "\n--- Scriere ASINCRONA (group commit) ---\n" << std::endl;
+    
+    {
+        ThreadSafeFile file("async_demo.txt");
+        file.startAsync(Durability::PerBatch);
+        
+        auto writerTask = [&file](int threadId) {
+            for (int i = 0; i < 100; ++i) {
+                file.writeAsync("Mesaj " + std::to_string(i), threadId);
+            }
+        };
+        
+        auto writer1 = pool.submit(writerTask, 1);
+        auto writer2 = pool.submit(writerTask, 2);
+        writer1.get();
+        writer2.get();
+        
+        file.waitDurable();
+        std::cout << "200 de mesaje puse in coada fara I/O pe thread-urile writer;" << std::endl;
+        std::cout << "flusher-ul le-a scris in cateva scrieri mari, cu un flush per batch." << std::endl;
+    }
+    
+    // Demonstratie cu append lock-free (rezervare atomica de offset)
+    std::cout << "\n--- Scriere APPEND LOCK-FREE (rezervare de offset) ---\n" << std::endl;
+    
+    const std::string appendFile = "append_demo.txt";
+    {
+        ThreadSafeFile file(appendFile);
+        file.enableLockFreeAppend();
+        
+        auto writerTask = [&file](int threadId) {
+            for (int i = 0; i < 100; ++i) {
+                file.writeSync("Mesaj " + std::to_string(i), threadId);
+            }
+        };
+        
+        auto writer1 = pool.submit(writerTask, 1);
+        auto writer2 = pool.submit(writerTask, 2);
+        writer1.get();
+        writer2.get();
+        
+        std::string content = file.readSync(3);
+        std::cout << "200 de mesaje scrise cu pwrite in intervale rezervate atomic: "
+                  << std::count(content.begin(), content.end(), '\n') << " linii, "
+                  << file.committedSize() << " octeti publicati" << std::endl;
+    }
+    {
+        // Simulam un crash: o inregistrare partiala si o rezervare nescrisa
+        std::ofstream torn(appendFile, std::ios::app | std::ios::binary);
+        torn << "[Thread 9] Mesaj rup";
+        torn.write("\0\0\0\0", 4);
+    }
+    uint64_t kept = ThreadSafeFile::recoverTornTail(appendFile);
+    std::cout << "Dupa recuperare (recoverTornTail): " << kept << " octeti - coada rupta a fost eliminata" << std::endl;
+}
+
+// ============================================================================
+// Demonstratie: RAII pentru Mutex (lock_guard, unique_lock)
+// ============================================================================
+inline void demonstrateMutexRAII() {
+    std::cout << "\n";
+    std::cout << "============================================================\n";
+    std::cout << "  RAII pentru Mutex: lock_guard si unique_lock\n";
+    std::cout << "============================================================\n";
+    
+    std::mutex mtx;
+    int sharedData = 0;
+    
+    std::cout << "\n--- std::lock_guard (simplu, RAII) ---\n" << std::endl;
+    {
+        std::cout << "Intram in scope si luam lock-ul..." << std::endl;
+        std::lock_guard<std::mutex> lock(mtx);
+        
+        sharedData = 42;
+        std::cout << "Am modificat sharedData = " << sharedData << std::endl;
+        std::cout << "Lock-ul se elibereaza automat la iesirea din scope" << std::endl;
+    }
+    std::cout << "Lock eliberat!\n" << std::endl;
+    
+    std::cout << "\n--- std::unique_lock (flexibil) ---\n" << std::endl;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        std::cout << "Lock luat" << std::endl;
+        
+        sharedData = 100;
+        
+        lock.unlock();
+        std::cout << "Lock eliberat manual (pentru operatii care nu necesita lock)" << std::endl;
+        
+        // Operatii fara lock...
+        std::cout << "Facem operatii fara lock..." << std::endl;
+        
+        lock.lock();
+        std::cout << "Lock reluat" << std::endl;
+        
+        sharedData = 200;
+        std::cout << "sharedData = " << sharedData << std::endl;
+    }
+    
+    std::cout << "\n--- Avantaje RAII pentru mutex ---" << std::endl;
+    std::cout << "1. Lock-ul se elibereaza automat (chiar si la exceptii)" << std::endl;
+    std::cout << "2. Nu poti uita sa faci unlock" << std::endl;
+    std::cout << "3. Exception-safe" << std::endl;
+    std::cout << "4. Cod mai curat si mai sigur" << std::endl;
+}
+
+// ============================================================================
+// Exemplu complet: Producer-Consumer cu canal in memorie (MpscRingBuffer)
+// ============================================================================
+inline void demonstrateProducerConsumer() {
+    ThreadPool& pool = demoThreadPool();
+    std::cout << "\n";
+    std::cout << "============================================================\n";
+    std::cout << "  Producer-Consumer: Un thread scrie, altul citeste\n";
+    std::cout << "============================================================\n";
+    
+    // Mesajul transmis prin canal: id + momentul trimiterii
+    struct Message {
+        int id = 0;
+        std::chrono::steady_clock::time_point sentAt;
+    };
+    
+    MpscRingBuffer<Message> channel(64);
+    std::string sharedFilename = "producer_consumer.txt";
+    
+    // Cream fisierul - consumatorul este singurul care scrie in el
+    {
+        std::ofstream file(sharedFilename, std::ios::trunc);
+        file << "=== Log Start ===\n";
+    }
+    
+    // Producer thread - trimite mesaje prin canal (fara lock, fara I/O)
+    auto producer = [&]() {
+        std::cout << "[Producer] Pornit" << std::endl;
+        
+        for (int i = 1; i <= 5; ++i) {
+            channel.push(Message{i, std::chrono::steady_clock::now()});
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        
+        channel.close();
+        std::cout << "[Producer] Terminat" << std::endl;
+    };
+    
+    FileTailReader tail(sharedFilename);
+    
+    // Consumer thread - este trezit imediat ce apare un mesaj (fara polling)
+    auto consumer = [&]() {
+        std::cout << "[Consumer] Pornit" << std::endl;
+        std::ofstream file(sharedFilename, std::ios::app);
+        
+        Message msg;
+        while (channel.pop(msg)) {
+            auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - msg.sentAt);
+            file << "Mesaj #" << msg.id << " - timestamp: "
+                 << std::chrono::system_clock::now().time_since_epoch().count() << "\n";
+            file.flush();
+            tail.notifyAppended();
+            std::cout << "[Consumer] Primit mesaj #" << msg.id 
+                      << " dupa " << latency.count() << " us" << std::endl;
+        }
+        
+        tail.close();
+        std::cout << "[Consumer] Terminat" << std::endl;
+    };
+    
+    // Tail thread - urmareste log-ul incremental: citeste doar octetii noi
+    auto tailer = [&]() {
+        std::string content;
+        while (tail.waitForData()) {
+            size_t got = tail.readNew(content);
+            std::cout << "[Tail] +" << got << " bytes (offset " << tail.position() << ")" << std::endl;
+        }
+        tail.readNew(content);  // ce a ramas dupa ultima notificare
+        std::cout << "\n[Tail] Continut final:\n" << content << std::endl;
+    };
+    
+    auto producerDone = pool.submit(producer);
+    auto consumerDone = pool.submit(consumer);
+    auto tailDone = pool.submit(tailer);
+    
+    producerDone.get();
+    consumerDone.get();
+    tailDone.get();
+    
+    std::cout << "\nProducer-Consumer finalizat cu succes!" << std::endl;
+    std::cout << "Canalul lock-free a livrat mesajele in microsecunde, fara polling." << std::endl;
+}
+
+// ============================================================================
+// Functie principala de demonstratie
+// ============================================================================
+inline void demonstrateThreading() {
+    std::cout << "\n";
+    std::cout << "************************************************************\n";
+    std::cout << "*                                                          *\n";
+    std::cout << "*     THREADING: Sincronizare cu Mutex                    *\n";
+    std::cout << "*     (Ilustrare din poza: threaduri sincronizate         *\n";
+    std::cout << "*      si desincronizate care manageuiesc aceleasi        *\n";
+    std::cout << "*      resurse)                                           *\n";
+    std::cout << "*                                                          *\n";
+    std::cout << "************************************************************\n";
+    
+    std::cout << "\nVom demonstra:" << std::endl;
+    std::cout << "1. Ce se intampla FARA sincronizare (race conditions)" << std::endl;
+    std::cout << "2. Cum rezolvam cu MUTEX (sincronizare corecta)" << std::endl;
+    std::cout << "3. RAII pentru mutex (lock_guard, unique_lock)" << std::endl;
+    std::cout << "4. Producer-Consumer: un thread scrie, altul citeste\n" << std::endl;
+    
+    demonstrateWithoutSync();
+    demonstrateWithSync();
+    demonstrateMutexRAII();
+    demonstrateProducerConsumer();
+    
+    std::cout << "\n";
+    std::cout << "============================================================\n";
+    std::cout << "  REZUMAT THREADING\n";
+    std::cout << "============================================================\n";
+    std::cout << "\nProbleme FARA sincronizare:" << std::endl;
+    std::cout << "- Race conditions: rezultate imprevizibile" << std::endl;
+    std::cout << "- Date corupte" << std::endl;
+    std::cout << "- Comportament nedeterminist" << std::endl;
+    
+    std::cout << "\nSolutii pentru sincronizare:" << std::endl;
+    std::cout << "- std::mutex + std::lock_guard (RAII)" << std::endl;
+    std::cout << "- std::atomic pentru operatii simple" << std::endl;
+    std::cout << "- StripedCounter pentru contoare incrementate de multe thread-uri" << std::endl;
+    std::cout << "- ThreadPool: thread-uri create o data si refolosite (submit + future)" << std::endl;
+    std::cout << "- std::unique_lock pentru control mai fin" << std::endl;
+    
+    std::cout << "\nBest practices:" << std::endl;
+    std::cout << "- Foloseste RAII pentru lock-uri (lock_guard)" << std::endl;
+    std::cout << "- Minimizeaza timpul cat tii lock-ul" << std::endl;
+    std::cout << "- Evita deadlock-uri (ordinea lock-urilor)" << std::endl;
+    std::cout << "- Prefera std::atomic pentru operatii simple" << std::endl;
+}
+
+#endif // THREADING_DEMO_HPP
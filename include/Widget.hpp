@@ -1,43 +1,69 @@
-#ifndef WIDGET_HPP
-#define WIDGET_HPP
-
-#include <string>
-
-/**
- * Clasa Widget demonstreaza in mod explicit:
- * Item 11: Handle assignment to self in operator=
- * 
- * Aceasta clasa arata probleme care pot aparea fara verificarea self-assignment
- */
-class Widget {
-private:
-    std::string* data;
-    int id;
-
-public:
-    // Constructor
-    Widget(int id = 0, const std::string& dataStr = "");
-    
-    // Copy constructor
-    Widget(const Widget& other);
-    
-    // Assignment operator - demonstreaza importanta verificarii self-assignment
-    Widget& operator=(const Widget& rhs);
-    
-    // Alternative safe assignment (exception-safe)
-    Widget& operatorAssignmentSafe(const Widget& rhs);
-    
-    // Destructor
-    ~Widget();
-    
-    // Display
-    void display() const;
-    
-    // Getters
-    int getId() const;
-    std::string getData() const;
-};
-
-#endif // WIDGET_HPP
-
-
+#ifndef WIDGET_HPP
+#define WIDGET_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * Clasa Widget demonstreaza in mod explicit:
+ * Item 11: Handle assignment to self in operator=
+ * 
+ * Aceasta clasa arata probleme care pot aparea fara verificarea self-assignment
+ */
+class Widget {
+private:
+    std::string* data;
+    int id;
+
+public:
+    // Constructor
+    Widget(int id = 0, const std::string& dataStr = "");
+    
+    // Copy constructor
+    Widget(const Widget& other);
+    
+    // Move constructor - preia pointerul, sursa ramane cu data == nullptr
+    Widget(Widget&& other) noexcept;
+    
+    // Assignment operator - demonstreaza importanta verificarii self-assignment
+    Widget& operator=(const Widget& rhs);
+    
+    // Move assignment
+    Widget& operator=(Widget&& rhs) noexcept;
+    
+    // Alternative safe assignment (exception-safe, copy-and-swap)
+    Widget& operatorAssignmentSafe(const Widget& rhs);
+    
+    // Schimba continutul, fara alocari si fara exceptii
+    void swap(Widget& other) noexcept;
+    
+    // Destructor
+    ~Widget();
+    
+    // Alocare din SlabPool<Widget> (cache per thread, fara lock pe calea rapida)
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p, std::size_t size) noexcept;
+    
+    // Display
+    void display() const;
+    
+    // Getters
+    int getId() const;
+    std::string getData() const;
+    
+    // Fara alocari; vedere goala pentru un Widget mutat
+    std::string_view getDataView() const noexcept;
+};
+
+inline std::string_view Widget::getDataView() const noexcept {
+    return data ? std::string_view(*data) : std::string_view();
+}
+
+inline void swap(Widget& a, Widget& b) noexcept {
+    a.swap(b);
+}
+
+#endif // WIDGET_HPP
+
+
@@ -0,0 +1,150 @@
+#include "EmployeeStore.hpp"
+#include <stdexcept>
+
+EmployeeStore::EmployeeStore() {
+    idOffsets.push_back(0);
+}
+
+void EmployeeStore::reserve(size_t count, size_t averageIdLength) {
+    salaries.reserve(count);
+    ages.reserve(count);
+    departmentIds.reserve(count);
+    idOffsets.reserve(count + 1);
+    idChars.reserve(count * averageIdLength);
+}
+
+uint32_t EmployeeStore::internDepartment(std::string_view name) {
+    std::string key(name);
+    auto it = departmentIndex.find(key);
+    if (it != departmentIndex.end()) {
+        return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(departmentNames.size());
+    departmentNames.push_back(key);
+    departmentIndex.emplace(std::move(key), id);
+    return id;
+}
+
+uint32_t EmployeeStore::findDepartment(std::string_view name) const {
+    auto it = departmentIndex.find(std::string(name));
+    return it == departmentIndex.end() ? kNoDepartment : it->second;
+}
+
+void EmployeeStore::add(std::string_view employeeId, int age, double salary, std::string_view department) {
+    add(employeeId, age, salary, internDepartment(department));
+}
+
+void EmployeeStore::add(std::string_view employeeId, int age, double salary, uint32_t departmentId) {
+    // Kernel-urile indexeaza direct cu id-ul (sums[d[i]]): nu acceptam id-uri
+    // care nu vin din internDepartment (ex. kNoDepartment de la findDepartment)
+    if (departmentId >= departmentNames.size()) {
+        throw std::out_of_range("Departament inexistent: " + std::to_string(departmentId));
+    }
+    // Offset-urile sunt pe 32 de biti
+    if (employeeId.size() > UINT32_MAX - idChars.size()) {
+        throw std::length_error("EmployeeStore: id-urile depasesc 4 GiB");
+    }
+    salaries.push_back(salary);
+    ages.push_back(age);
+    departmentIds.push_back(departmentId);
+    idChars.insert(idChars.end(), employeeId.begin(), employeeId.end());
+    idOffsets.push_back(static_cast<uint32_t>(idChars.size()));
+}
+
+void EmployeeStore::add(const Employee& employee) {
+    add(employee.getEmployeeIdView(), employee.getAge(), employee.getSalary(), employee.getDepartmentView());
+}
+
+// ============================================================================
+// Kernel-uri
+// Patru acumulatori independenti: adunarile in virgula mobila nu sunt
+// asociative, deci compilatorul nu poate vectoriza singur o suma cu un
+// singur acumulator (fara -ffast-math). Cu patru, dependenta se rupe.
+// ============================================================================
+
+double EmployeeStore::totalSalary() const {
+    const double* s = salaries.data();
+    const size_t n = salaries.size();
+    double a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        a0 += s[i];
+        a1 += s[i + 1];
+        a2 += s[i + 2];
+        a3 += s[i + 3];
+    }
+    for (; i < n; ++i) {
+        a0 += s[i];
+    }
+    return (a0 + a1) + (a2 + a3);
+}
+
+double EmployeeStore::totalSalary(uint32_t departmentId) const {
+    const double* s = salaries.data();
+    const uint32_t* d = departmentIds.data();
+    const size_t n = salaries.size();
+    double a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    size_t i = 0;
+    // Fara ramificatii: select (blend), nu inmultire cu 0/1 - altfel un
+    // salariu inf/NaN din alt departament ar da 0 * inf = NaN in suma
+    for (; i + 4 <= n; i += 4) {
+        a0 += (d[i] == departmentId) ? s[i] : 0.0;
+        a1 += (d[i + 1] == departmentId) ? s[i + 1] : 0.0;
+        a2 += (d[i + 2] == departmentId) ? s[i + 2] : 0.0;
+        a3 += (d[i + 3] == departmentId) ? s[i + 3] : 0.0;
+    }
+    for (; i < n; ++i) {
+        a0 += (d[i] == departmentId) ? s[i] : 0.0;
+    }
+    return (a0 + a1) + (a2 + a3);
+}
+
+double EmployeeStore::averageSalary() const {
+    return salaries.empty() ? 0.0 : totalSalary() / static_cast<double>(salaries.size());
+}
+
+std::vector<uint32_t> EmployeeStore::filterByAge(int minAge, int maxAge) const {
+    const int32_t* a = ages.data();
+    const size_t n = ages.size();
+    std::vector<uint32_t> result(n);
+    uint32_t* out = result.data();
+    size_t count = 0;
+    // Scriere neconditionata + avans conditionat (fara branch mispredict)
+    for (size_t i = 0; i < n; ++i) {
+        out[count] = static_cast<uint32_t>(i);
+        count += static_cast<size_t>((a[i] >= minAge) & (a[i] <= maxAge));
+    }
+    result.resize(count);
+    return result;
+}
+
+size_t EmployeeStore::countByAge(int minAge, int maxAge) const {
+    const int32_t* a = ages.data();
+    const size_t n = ages.size();
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i) {
+        count += static_cast<size_t>((a[i] >= minAge) & (a[i] <= maxAge));
+    }
+    return count;
+}
+
+std::vector<double> EmployeeStore::salaryByDepartment() const {
+    std::vector<double> sums(departmentNames.size(), 0.0);
+    const double* s = salaries.data();
+    const uint32_t* d = departmentIds.data();
+    const size_t n = salaries.size();
+    for (size_t i = 0; i < n; ++i) {
+        sums[d[i]] += s[i];
+    }
+    return sums;
+}
+
+std::vector<size_t> EmployeeStore::headcountByDepartment() const {
+    std::vector<size_t> counts(departmentNames.size(), 0);
+    const uint32_t* d = departmentIds.data();
+    const size_t n = departmentIds.size();
+    for (size_t i = 0; i < n; ++i) {
+        ++counts[d[i]];
+    }
+    return counts;
+}
@@ -1,87 +1,121 @@
-#include "Person.hpp"
-#include <iostream>
-
-// Constructor
-Person::Person(const std::string& name, int age, const std::string& addr)
-    : name(name), age(age), address(new std::string(addr)) {
-    std::cout << "Person constructor called for: " << name << std::endl;
-}
-
-// Copy constructor - Item 12: Copy ALL parts of an object
-Person::Person(const Person& other)
-    : name(other.name), age(other.age), address(new std::string(*other.address)) {
-    std::cout << "Person copy constructor called for: " << name << std::endl;
-}
-
-// Assignment operator
-// Item 10: Return a reference to *this
-// Item 11: Handle assignment to self
-// Item 12: Copy all parts
-Person& Person::operator=(const Person& rhs) {
-    std::cout << "Person assignment operator called" << std::endl;
-    
-    // Item 11: Check for self-assignment
-    // Fara aceasta verificare, ar putea aparea probleme:
-    // - delete address ar sterge si rhs.address (daca this == &rhs)
-    // - apoi incercam sa copiem din memorie stearsa
-    if (this == &rhs) {
-        std::cout << "  -> Self-assignment detected, returning *this" << std::endl;
-        return *this;  // Item 10: return reference to *this
-    }
-    
-    // Item 12: Copy ALL members
-    name = rhs.name;
-    age = rhs.age;
-    
-    // Deep copy pentru pointeri
-    delete address;
-    address = new std::string(*rhs.address);
-    
-    // Item 10: Return a reference to *this
-    // Acest lucru permite chaining: a = b = c;
-    return *this;
-}
-
-// Destructor
-Person::~Person() {
-    std::cout << "Person destructor called for: " << name << std::endl;
-    delete address;
-}
-
-// Getters
-std::string Person::getName() const {
-    return name;
-}
-
-int Person::getAge() const {
-    return age;
-}
-
-std::string Person::getAddress() const {
-    return address ? *address : "";
-}
-
-// Setters
-void Person::setName(const std::string& name) {
-    this->name = name;
-}
-
-void Person::setAge(int age) {
-    this->age = age;
-}
-
-void Person::setAddress(const std::string& addr) {
-    if (address) {
-        *address = addr;
-    } else {
-        address = new std::string(addr);
-    }
-}
-
-// Display
-void Person::display() const {
-    std::cout << "Person: " << name << ", Age: " << age 
-              << ", Address: " << (address ? *address : "N/A") << std::endl;
-}
-
-
+#include "Person.hpp"
+#include "Logger.hpp"
+#include "SlabPool.hpp"
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+// std::vector<Person> realoca prin move doar daca move-ul este noexcept
+static_assert(std::is_nothrow_move_constructible<Person>::value, "Person trebuie mutat fara exceptii");
+static_assert(std::is_nothrow_move_assignable<Person>::value, "Person trebuie mutat fara exceptii");
+
+// Constructor
+Person::Person(const std::string& name, int age, const std::string& addr)
+    : name(name), age(age), address(addr) {
+    LOG_TRACE("Person constructor called for: " << name);
+}
+
+// Copy constructor - Item 12: Copy ALL parts of an object
+// Stringurile sunt membri inline: copia aloca doar daca textul depaseste SSO
+Person::Person(const Person& other)
+    : name(other.name), age(other.age), address(other.address) {
+    LOG_TRACE("Person copy constructor called for: " << name);
+}
+
+// Move constructor - preia buffer-ele stringurilor, fara alocari.
+// Operatiile de move nu logheaza: formatarea mesajului aloca si ar putea
+// arunca dintr-o functie noexcept (std::terminate)
+Person::Person(Person&& other) noexcept
+    : name(std::move(other.name)), age(other.age), address(std::move(other.address)) {}
+
+// Assignment operator
+// Item 10: Return a reference to *this
+// Item 11: Handle assignment to self
+// Item 12: Copy all parts
+Person& Person::operator=(const Person& rhs) {
+    LOG_TRACE("Person assignment operator called");
+    
+    // Item 11: Check for self-assignment
+    // Cu membri inline, std::string::operator= trateaza deja self-assignment;
+    // verificarea ramane ca optimizare (evitam copierea inutila)
+    if (this == &rhs) {
+        LOG_TRACE("  -> Self-assignment detected, returning *this");
+        return *this;  // Item 10: return reference to *this
+    }
+    
+    // Item 12: Copy ALL members
+    // operator= pe string refoloseste capacitatea existenta (de obicei 0 alocari)
+    name = rhs.name;
+    age = rhs.age;
+    address = rhs.address;
+    
+    // Item 10: Return a reference to *this
+    // Acest lucru permite chaining: a = b = c;
+    return *this;
+}
+
+// Move assignment
+Person& Person::operator=(Person&& rhs) noexcept {
+    if (this != &rhs) {
+        name = std::move(rhs.name);
+        age = rhs.age;
+        address = std::move(rhs.address);
+    }
+    return *this;
+}
+
+void Person::swap(Person& other) noexcept {
+    using std::swap;
+    swap(name, other.name);
+    swap(age, other.age);
+    swap(address, other.address);
+}
+
+// Obiectele vin din pool-ul tipului; SlabPool trimite cererile de alta
+// dimensiune (clase derivate fara operator new propriu) catre ::operator new
+void* Person::operator new(std::size_t size) {
+    return SlabPool<Person>::allocate(size);
+}
+
+void Person::operator delete(void* p, std::size_t size) noexcept {
+    SlabPool<Person>::deallocate(p, size);
+}
+
+// Destructor
+Person::~Person() {
+    LOG_TRACE("Person destructor called for: " << name);
+}
+
+// Getters
+std::string Person::getName() const {
+    return name;
+}
+
+int Person::getAge() const {
+    return age;
+}
+
+std::string Person::getAddress() const {
+    return address;
+}
+
+// Setters
+void Person::setName(const std::string& name) {
+    this->name = name;
+}
+
+void Person::setAge(int age) {
+    this->age = age;
+}
+
+void Person::setAddress(const std::string& addr) {
+    address = addr;
+}
+
+// Display
+void Person::display() const {
+    std::cout << "Person: " << name << ", Age: " << age 
+              << ", Address: " << address << std::endl;
+}
+
+
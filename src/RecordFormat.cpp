@@ -0,0 +1,309 @@
+#include "RecordFormat.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace recordformat;
+
+namespace {
+
+// Un bloc nu poate depasi offset-urile pe 32 de biti; il inchidem mult inainte
+constexpr size_t kMaxBlockStringBytes = size_t(64) << 20;
+
+size_t columnBytes(RecordKind kind, size_t count) {
+    return count * (kind == RecordKind::Employee ? sizeof(double) + sizeof(int32_t) : sizeof(int32_t));
+}
+
+size_t rawBlockBytes(RecordKind kind, size_t count, size_t stringBytes) {
+    return kBlockHeaderSize + columnBytes(kind, count)
+        + (count * stringsPerRecord(kind) + 1) * sizeof(uint32_t) + stringBytes;
+}
+
+} // namespace
+
+// ============================================================================
+// RecordWriter
+// ============================================================================
+
+RecordWriter::RecordWriter(const std::string& path, RecordKind kind, size_t recordsPerBlock)
+    : out(path, std::ios::binary | std::ios::trunc),
+      recordKind(kind),
+      blockRecords(recordsPerBlock == 0 ? 1 : recordsPerBlock) {
+    if (!out) {
+        throw std::runtime_error("Nu pot crea fisierul " + path);
+    }
+    char header[kFileHeaderSize] = {};
+    std::memcpy(header, kMagic, sizeof(kMagic));
+    store<uint16_t>(header + 4, kVersion);
+    store<uint16_t>(header + 6, static_cast<uint16_t>(kind));
+    store<uint32_t>(header + 8, kEndianTag);
+    out.write(header, sizeof(header));
+
+    if (kind == RecordKind::Employee) {
+        salaries.reserve(blockRecords);
+    }
+    ages.reserve(blockRecords);
+    offsets.reserve(blockRecords * stringsPerRecord(kind) + 1);
+    offsets.push_back(0);
+}
+
+RecordWriter::~RecordWriter() {
+    try {
+        close();
+    } catch (...) {
+        // Destructorii nu arunca; apelantul care vrea erorile apeleaza close()
+    }
+}
+
+void RecordWriter::appendString(std::string_view s) {
+    strings.append(s.data(), s.size());
+    offsets.push_back(static_cast<uint32_t>(strings.size()));
+}
+
+void RecordWriter::endRecord() {
+    ++written;
+    if (ages.size() >= blockRecords || strings.size() >= kMaxBlockStringBytes) {
+        flushBlock();
+    }
+}
+
+void RecordWriter::write(const Person& person) {
+    if (recordKind == RecordKind::Employee) {
+        throw std::invalid_argument("Person intr-un fisier de Employee: lipsesc campurile de angajat");
+    }
+    writePerson(person.getNameView(), person.getAge(), person.getAddressView());
+}
+
+void RecordWriter::write(const Employee& employee) {
+    if (recordKind == RecordKind::Person) {
+        writePerson(employee.getNameView(), employee.getAge(), employee.getAddressView());
+        return;
+    }
+    writeEmployee(employee.getNameView(), employee.getAge(), employee.getAddressView(),
+                  employee.getEmployeeIdView(), employee.getSalary(), employee.getDepartmentView());
+}
+
+void RecordWriter::writePerson(std::string_view name, int age, std::string_view address) {
+    if (recordKind == RecordKind::Employee) {
+        throw std::invalid_argument("Person intr-un fisier de Employee: lipsesc campurile de angajat");
+    }
+    ages.push_back(age);
+    appendString(name);
+    appendString(address);
+    endRecord();
+}
+
+void RecordWriter::writeEmployee(std::string_view name, int age, std::string_view address,
+                                 std::string_view employeeId, double salary, std::string_view department) {
+    if (recordKind == RecordKind::Person) {
+        writePerson(name, age, address);
+        return;
+    }
+    salaries.push_back(salary);
+    ages.push_back(age);
+    appendString(name);
+    appendString(address);
+    appendString(employeeId);
+    appendString(department);
+    endRecord();
+}
+
+// Blocul e asamblat intr-un singur buffer si scris cu un singur write()
+void RecordWriter::flushBlock() {
+    const size_t count = ages.size();
+    if (count == 0) {
+        return;
+    }
+    const size_t raw = rawBlockBytes(recordKind, count, strings.size());
+    const size_t blockBytes = alignUp8(raw);
+    blockBuffer.assign(blockBytes, 0);   // padding-ul ramane 0
+
+    char* p = blockBuffer.data();
+    store<uint32_t>(p, static_cast<uint32_t>(count));
+    store<uint32_t>(p + 4, static_cast<uint32_t>(strings.size()));
+    store<uint64_t>(p + 8, static_cast<uint64_t>(blockBytes));
+    p += kBlockHeaderSize;
+    if (recordKind == RecordKind::Employee) {
+        std::memcpy(p, salaries.data(), count * sizeof(double));
+        p += count * sizeof(double);
+    }
+    std::memcpy(p, ages.data(), count * sizeof(int32_t));
+    p += count * sizeof(int32_t);
+    std::memcpy(p, offsets.data(), offsets.size() * sizeof(uint32_t));
+    p += offsets.size() * sizeof(uint32_t);
+    std::memcpy(p, strings.data(), strings.size());
+
+    out.write(blockBuffer.data(), static_cast<std::streamsize>(blockBytes));
+
+    // Capacitatea ramane: blocul urmator nu mai aloca
+    salaries.clear();
+    ages.clear();
+    offsets.clear();
+    offsets.push_back(0);
+    strings.clear();
+}
+
+void RecordWriter::flush() {
+    flushBlock();
+    out.flush();
+}
+
+void RecordWriter::close() {
+    if (!out.is_open()) {
+        return;
+    }
+    flushBlock();
+    out.close();
+    if (!out) {
+        throw std::runtime_error("Scrierea fisierului de record-uri a esuat");
+    }
+}
+
+// ============================================================================
+// RecordReader
+// ============================================================================
+
+RecordReader::RecordReader(const std::string& path) : file(path) {
+    if (!file.isMapped()) {
+        throw std::runtime_error("Nu pot mapa fisierul " + path);
+    }
+    const char* data = file.view().data();
+    const size_t length = file.size();
+    if (length < kFileHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error(path + ": nu este un fisier de record-uri");
+    }
+    // Coloanele sunt folosite direct din mapare (vezi "Aliniere" in header)
+    if (reinterpret_cast<uintptr_t>(data) % alignof(double) != 0) {
+        throw std::runtime_error(path + ": maparea nu este aliniata");
+    }
+    fileVersion = load<uint16_t>(data + 4);
+    if (fileVersion == 0 || fileVersion > kVersion) {
+        throw std::runtime_error(path + ": versiune necunoscuta " + std::to_string(fileVersion));
+    }
+    if (load<uint32_t>(data + 8) != kEndianTag) {
+        throw std::runtime_error(path + ": scris pe o masina cu alta ordine a octetilor");
+    }
+    uint16_t kind = load<uint16_t>(data + 6);
+    if (kind != static_cast<uint16_t>(RecordKind::Person) && kind != static_cast<uint16_t>(RecordKind::Employee)) {
+        throw std::runtime_error(path + ": tip de record necunoscut " + std::to_string(kind));
+    }
+    recordKind = static_cast<RecordKind>(kind);
+    const size_t stride = stringsPerRecord(recordKind);
+
+    // Doar antetele de bloc si ultimul offset: restul datelor raman neatinse
+    // pana sunt citite
+    size_t pos = kFileHeaderSize;
+    while (pos < length) {
+        if (length - pos < kBlockHeaderSize) {
+            throw std::runtime_error(path + ": bloc trunchiat la offset " + std::to_string(pos));
+        }
+        const char* base = data + pos;
+        const size_t count = load<uint32_t>(base);
+        const size_t stringBytes = load<uint32_t>(base + 4);
+        const uint64_t blockBytes = load<uint64_t>(base + 8);
+        if (blockBytes != alignUp8(rawBlockBytes(recordKind, count, stringBytes)) || blockBytes > length - pos) {
+            throw std::runtime_error(path + ": bloc invalid la offset " + std::to_string(pos));
+        }
+
+        RecordBlock block;
+        block.count = count;
+        block.stride = stride;
+        block.firstRecord = total;
+        const char* p = base + kBlockHeaderSize;
+        // pos e multiplu de 8: salariile sunt aliniate la 8, restul la 4
+        if (recordKind == RecordKind::Employee) {
+            block.salaries = reinterpret_cast<const double*>(p);
+            p += count * sizeof(double);
+        }
+        block.ages = reinterpret_cast<const int32_t*>(p);
+        p += count * sizeof(int32_t);
+        block.offsets = reinterpret_cast<const uint32_t*>(p);
+        p += (count * stride + 1) * sizeof(uint32_t);
+        block.strings = p;
+        if (block.offsets[0] != 0 || block.offsets[count * stride] != stringBytes) {
+            throw std::runtime_error(path + ": tabela de offset-uri invalida la offset " + std::to_string(pos));
+        }
+
+        blocks.push_back(block);
+        total += count;
+        pos += static_cast<size_t>(blockBytes);
+    }
+}
+
+const RecordBlock& RecordReader::blockOf(size_t index, size_t& row) const {
+    if (index >= total) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    auto it = std::upper_bound(blocks.begin(), blocks.end(), index,
+                               [](size_t i, const RecordBlock& b) { return i < b.firstRecord; });
+    const RecordBlock& block = *(it - 1);
+    row = index - block.firstRecord;
+    return block;
+}
+
+std::string_view RecordReader::name(size_t index) const {
+    size_t row;
+    const RecordBlock& block = blockOf(index, row);
+    return block.name(row);
+}
+
+int RecordReader::age(size_t index) const {
+    size_t row;
+    const RecordBlock& block = blockOf(index, row);
+    return block.age(row);
+}
+
+Person RecordReader::person(size_t index) const {
+    size_t row;
+    const RecordBlock& block = blockOf(index, row);
+    return Person(std::string(block.name(row)), block.age(row), std::string(block.address(row)));
+}
+
+Employee RecordReader::employee(size_t index) const {
+    if (recordKind != RecordKind::Employee) {
+        throw std::invalid_argument("Fisierul contine Person, nu Employee");
+    }
+    size_t row;
+    const RecordBlock& block = blockOf(index, row);
+    return Employee(std::string(block.name(row)), block.age(row), std::string(block.address(row)),
+                    std::string(block.employeeId(row)), block.salary(row), std::string(block.department(row)));
+}
+
+bool RecordReader::verify() const {
+    for (const RecordBlock& block : blocks) {
+        const size_t n = block.count * block.stride;
+        for (size_t j = 0; j < n; ++j) {
+            if (block.offsets[j] > block.offsets[j + 1]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Incarcare in EmployeeStore
+// ============================================================================
+
+size_t loadEmployees(const RecordReader& reader, EmployeeStore& store) {
+    if (reader.kind() != RecordKind::Employee) {
+        throw std::invalid_argument("Fisierul contine Person, nu Employee");
+    }
+    store.reserve(store.size() + reader.size());
+
+    // Putine departamente, multi angajati: cheile sunt vederi in mapare, deci
+    // cautarea nu construieste std::string; internDepartment doar la prima aparitie
+    std::unordered_map<std::string_view, uint32_t> departments;
+    for (size_t b = 0; b < reader.blockCount(); ++b) {
+        const RecordBlock& block = reader.block(b);
+        for (size_t i = 0; i < block.size(); ++i) {
+            std::string_view department = block.department(i);
+            auto it = departments.find(department);
+            if (it == departments.end()) {
+                it = departments.emplace(department, store.internDepartment(department)).first;
+            }
+            store.add(block.employeeId(i), block.age(i), block.salary(i), it->second);
+        }
+    }
+    return reader.size();
+}
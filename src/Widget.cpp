@@ -1,83 +1,123 @@
-#include "Widget.hpp"
-#include <iostream>
-
-// Constructor
-Widget::Widget(int id, const std::string& dataStr)
-    : data(new std::string(dataStr)), id(id) {
-    std::cout << "Widget constructor called for ID: " << id << std::endl;
-}
-
-// Copy constructor
-Widget::Widget(const Widget& other)
-    : data(new std::string(*other.data)), id(other.id) {
-    std::cout << "Widget copy constructor called for ID: " << id << std::endl;
-}
-
-// Assignment operator - demonstreaza importanta verificarii self-assignment
-// Item 10: Return reference to *this
-// Item 11: Handle assignment to self
-Widget& Widget::operator=(const Widget& rhs) {
-    std::cout << "Widget assignment operator called" << std::endl;
-    
-    // Item 11: CRITICAL - Check for self-assignment
-    // Fara aceasta verificare:
-    // 1. delete data; ar sterge si rhs.data (daca this == &rhs)
-    // 2. apoi new std::string(*rhs.data) ar incerca sa acceseze memorie stearsa
-    // 3. rezultat: undefined behavior, crash potential
-    
-    if (this == &rhs) {
-        std::cout << "  -> Self-assignment detected! Avoiding undefined behavior." << std::endl;
-        return *this;  // Item 10: return *this
-    }
-    
-    std::cout << "  -> Different objects, proceeding with assignment" << std::endl;
-    
-    // Safe to proceed
-    id = rhs.id;
-    delete data;
-    data = new std::string(*rhs.data);
-    
-    // Item 10: Return reference to *this pentru chaining
-    return *this;
-}
-
-// Alternative: Exception-safe assignment (copy-and-swap idiom)
-Widget& Widget::operatorAssignmentSafe(const Widget& rhs) {
-    std::cout << "Widget safe assignment operator called" << std::endl;
-    
-    // Aceasta tehnica este si exception-safe si handleaza self-assignment automat
-    // Nu mai este nevoie de verificare explicita pentru self-assignment
-    
-    // Create temporary copy
-    std::string* temp = new std::string(*rhs.data);
-    
-    // If above succeeds (no exception), now modify this object
-    delete data;
-    data = temp;
-    id = rhs.id;
-    
-    return *this;
-}
-
-// Destructor
-Widget::~Widget() {
-    std::cout << "Widget destructor called for ID: " << id << std::endl;
-    delete data;
-}
-
-// Display
-void Widget::display() const {
-    std::cout << "Widget ID: " << id << ", Data: " 
-              << (data ? *data : "N/A") << std::endl;
-}
-
-// Getters
-int Widget::getId() const {
-    return id;
-}
-
-std::string Widget::getData() const {
-    return data ? *data : "";
-}
-
-
+#include "Widget.hpp"
+#include "Logger.hpp"
+#include "SlabPool.hpp"
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+static_assert(std::is_nothrow_move_constructible<Widget>::value, "Widget trebuie mutat fara exceptii");
+static_assert(std::is_nothrow_move_assignable<Widget>::value, "Widget trebuie mutat fara exceptii");
+
+// Constructor
+Widget::Widget(int id, const std::string& dataStr)
+    : data(new std::string(dataStr)), id(id) {
+    LOG_TRACE("Widget constructor called for ID: " << id);
+}
+
+// Copy constructor
+// Sursa poate fi un obiect mutat (data == nullptr) - copia ramane si ea goala
+Widget::Widget(const Widget& other)
+    : data(other.data ? new std::string(*other.data) : nullptr), id(other.id) {
+    LOG_TRACE("Widget copy constructor called for ID: " << id);
+}
+
+// Move constructor - doar preia pointerul
+Widget::Widget(Widget&& other) noexcept
+    : data(other.data), id(other.id) {
+    other.data = nullptr;
+}
+
+// Assignment operator - demonstreaza importanta verificarii self-assignment
+// Item 10: Return reference to *this
+// Item 11: Handle assignment to self
+Widget& Widget::operator=(const Widget& rhs) {
+    LOG_TRACE("Widget assignment operator called");
+    
+    // Item 11: CRITICAL - Check for self-assignment
+    // Fara aceasta verificare:
+    // 1. delete data; ar sterge si rhs.data (daca this == &rhs)
+    // 2. apoi new std::string(*rhs.data) ar incerca sa acceseze memorie stearsa
+    // 3. rezultat: undefined behavior, crash potential
+    
+    if (this == &rhs) {
+        LOG_TRACE("  -> Self-assignment detected! Avoiding undefined behavior.");
+        return *this;  // Item 10: return *this
+    }
+    
+    LOG_TRACE("  -> Different objects, proceeding with assignment");
+    
+    // Safe to proceed
+    id = rhs.id;
+    delete data;
+    data = rhs.data ? new std::string(*rhs.data) : nullptr;
+    
+    // Item 10: Return reference to *this pentru chaining
+    return *this;
+}
+
+// Move assignment - eliberam resursa proprie si o preluam pe a sursei
+Widget& Widget::operator=(Widget&& rhs) noexcept {
+    if (this != &rhs) {
+        delete data;
+        data = rhs.data;
+        id = rhs.id;
+        rhs.data = nullptr;
+    }
+    return *this;
+}
+
+// Alternative: Exception-safe assignment (copy-and-swap idiom)
+Widget& Widget::operatorAssignmentSafe(const Widget& rhs) {
+    LOG_TRACE("Widget safe assignment operator called");
+    
+    // Aceasta tehnica este si exception-safe si handleaza self-assignment automat
+    // Nu mai este nevoie de verificare explicita pentru self-assignment
+    
+    // Create temporary copy - singurul pas care poate arunca
+    Widget temp(rhs);
+    
+    // Daca am ajuns aici, copia a reusit: swap nu arunca niciodata
+    swap(temp);
+    
+    // temp pleaca acum cu vechile date si le elibereaza in destructor
+    return *this;
+}
+
+void Widget::swap(Widget& other) noexcept {
+    using std::swap;
+    swap(data, other.data);
+    swap(id, other.id);
+}
+
+// Obiectele vin din pool-ul tipului; SlabPool trimite cererile de alta
+// dimensiune (clase derivate fara operator new propriu) catre ::operator new
+void* Widget::operator new(std::size_t size) {
+    return SlabPool<Widget>::allocate(size);
+}
+
+void Widget::operator delete(void* p, std::size_t size) noexcept {
+    SlabPool<Widget>::deallocate(p, size);
+}
+
+// Destructor
+Widget::~Widget() {
+    LOG_TRACE("Widget destructor called for ID: " << id);
+    delete data;
+}
+
+// Display
+void Widget::display() const {
+    std::cout << "Widget ID: " << id << ", Data: " 
+              << (data ? *data : "N/A") << std::endl;
+}
+
+// Getters
+int Widget::getId() const {
+    return id;
+}
+
+std::string Widget::getData() const {
+    return data ? *data : "";
+}
+
+